@@ -43,6 +43,8 @@ from pathlib import Path
 import subprocess
 import ctypes
 import ctypes.util
+import mmap
+import struct
 
 try:
     import pygame.joystick
@@ -109,6 +111,85 @@ class XPlaneAPI:
         return None
 
 
+class ShmExchangeReader:
+    """Zero-copy reader for the mfd_calcd shared-memory exchange segment.
+
+    Mirrors the layout in compliant/shm_exchange.h: a small header followed by
+    two double-buffered frames of plain IEEE-754 doubles.  The whole frame is
+    decoded with one struct.unpack_from call, so the per-frame cost is a seqlock
+    check plus one memcpy -- no subprocess, no argv strings, no JSON parsing.
+    Run mfd_calcd with --shm to populate the segment.
+    """
+
+    MAGIC = 0x4D464431
+    VERSION = 1
+    # uint32: magic, version, frame_bytes, active_index, sequence[2], reserved[2]
+    HEADER_FORMAT = "<8I"
+    HEADER_BYTES = struct.calcsize(HEADER_FORMAT)
+    INPUT_FIELDS = [
+        "tas_kts", "gs_kts", "heading_deg", "track_deg", "ias_kts", "mach",
+        "altitude_ft", "agl_ft", "vs_fpm", "weight_kg", "bank_deg", "vso_kts",
+        "vne_kts", "mmo", "wind_dir_deg", "wind_speed_kts", "target_alt_ft",
+        "distance_nm", "course_change_deg", "pressure_alt_ft", "oat_celsius",
+    ]
+    OUTPUT_FIELDS = [
+        "wind_speed_kts", "wind_direction_from", "wind_headwind", "wind_crosswind", "wind_gust_factor",
+        "comp_headwind", "comp_crosswind", "comp_total_wind", "comp_wca", "comp_drift",
+        "stall_margin_pct", "vmo_margin_pct", "mmo_margin_pct", "min_margin_pct", "load_factor", "corner_speed_kts",
+        "specific_energy_ft", "energy_rate_kts", "energy_trend",
+        "still_air_range_nm", "wind_adjusted_range_nm", "glide_ratio", "best_glide_speed_kts",
+        "turn_radius_nm", "turn_radius_ft", "turn_rate_dps", "lead_distance_nm", "lead_distance_ft",
+        "time_to_turn_sec", "turn_load_factor", "standard_rate_bank",
+        "altitude_to_lose_ft", "flight_path_angle_deg", "required_vs_fpm", "tod_distance_nm",
+        "time_to_constraint_min", "distance_per_1000ft", "vs_for_3deg", "is_descent",
+        "density_altitude_ft", "pressure_altitude_ft", "air_density_ratio", "temperature_deviation_c",
+        "performance_loss_pct", "eas_kts", "tas_to_ias_ratio", "pressure_ratio",
+    ]
+    FRAME_FIELDS = INPUT_FIELDS + OUTPUT_FIELDS
+    FRAME_FORMAT = f"<{len(FRAME_FIELDS)}d"
+    FRAME_BYTES = struct.calcsize(FRAME_FORMAT)
+
+    def __init__(self, name: str = "xplane_mfd_calc"):
+        self.path = f"/dev/shm/{name}"
+        self.mm = None
+
+    def open(self) -> bool:
+        """Map the segment; returns False if the daemon has not created it"""
+        try:
+            with open(self.path, "rb") as f:
+                self.mm = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+            magic, version, frame_bytes = struct.unpack_from("<3I", self.mm, 0)
+            if magic != self.MAGIC or version != self.VERSION or frame_bytes != self.FRAME_BYTES:
+                self.close()
+                return False
+            return True
+        except (OSError, ValueError):
+            self.mm = None
+            return False
+
+    def close(self):
+        if self.mm is not None:
+            self.mm.close()
+            self.mm = None
+
+    def read_latest(self, retries: int = 8) -> Optional[Dict[str, float]]:
+        """Read the latest stable frame as a field->value dict, or None"""
+        if self.mm is None:
+            return None
+        for _ in range(retries):
+            _, _, _, active, seq0, seq1, _, _ = struct.unpack_from(self.HEADER_FORMAT, self.mm, 0)
+            seq_before = seq1 if active == 1 else seq0
+            if seq_before & 1:
+                continue  # Writer mid-flight, retry
+            offset = self.HEADER_BYTES + active * self.FRAME_BYTES
+            values = struct.unpack_from(self.FRAME_FORMAT, self.mm, offset)
+            _, _, _, _, seq0, seq1, _, _ = struct.unpack_from(self.HEADER_FORMAT, self.mm, 0)
+            seq_after = seq1 if active == 1 else seq0
+            if seq_after == seq_before:
+                return dict(zip(self.FRAME_FIELDS, values))
+        return None
+
+
 class USBDeviceManager:
     """Manager for F16 MFD 2 USB device input using SDL2 joystick API"""
     
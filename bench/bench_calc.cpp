@@ -0,0 +1,418 @@
+// Micro-benchmark harness for the X-Plane MFD calculation cores
+// JSF AV C++ Coding Standard Compliant Version
+//
+// Self-contained timer suite (no external benchmark dependency) covering
+// every calculator kernel plus JSON serialization.  Each benchmark varies
+// its inputs per iteration and folds the results into a sink so the
+// optimizer cannot hoist or discard the work.  Iteration counts adapt until
+// a run is long enough to time reliably.
+//
+// Human-readable results go to stderr; stdout carries one JSON document
+// (ns/op per benchmark) for tracking across releases:
+//
+//   make bench > bench_results.json
+
+#include "batch_calc.h"
+#include "density_altitude_calc.h"
+#include "flight_calc.h"
+#include "glide_ring.h"
+#include "json_writer.h"
+#include "turn_arc.h"
+#include "simd_kernels.h"
+#include "turn_calc.h"
+#include "vnav_calc.h"
+#include "wind_calc.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+namespace
+{
+
+// Keep growing the iteration count until one run takes at least this long
+constexpr int64_t min_run_ns = 100000000;  // 100 ms
+
+constexpr int64_t initial_iterations = 1024;
+
+constexpr int32_t max_benchmarks = 16;
+
+// Results are folded in here so the kernels cannot be optimized away
+volatile double bench_sink = 0.0;
+
+// Read through a volatile so LTO builds cannot constant-propagate the
+// chunk size into the batch kernels and over-specialize the loops
+volatile size_t bench_chunk_size = airv::batch::chunk_size;
+
+inline void keep(double value)
+{
+    bench_sink = bench_sink + value;
+}
+
+struct BenchResult
+{
+    const char* name;
+    double ns_per_op;
+    int64_t iterations;
+};
+
+// Time fn(iterations) with an adaptive iteration count; fn must perform
+// exactly `iterations` operations of the kernel under test
+template<typename Fn>
+BenchResult run_benchmark(const char* name,
+                          Fn fn)
+{
+    BenchResult result;
+    int64_t iterations = initial_iterations;
+    int64_t elapsed_ns = 0;
+
+    fn(initial_iterations);  // Warm caches and the branch predictor
+
+    for (;;)
+    {
+        auto start = std::chrono::steady_clock::now();
+        fn(iterations);
+        auto stop = std::chrono::steady_clock::now();
+
+        elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+        if (elapsed_ns >= min_run_ns)
+        {
+            break;
+        }
+        iterations *= 2;
+    }
+
+    result.name       = name;
+    result.ns_per_op  = static_cast<double>(elapsed_ns) / static_cast<double>(iterations);
+    result.iterations = iterations;
+
+    return result;
+}
+
+// Cheap per-iteration input variation; keeps values in sane flight ranges
+inline double vary(int64_t i,
+                   double base,
+                   double spread)
+{
+    return base + (static_cast<double>(i & 63) * spread);
+}
+
+void bench_wind_vector(int64_t n)
+{
+    double sum = 0.0;
+    for (int64_t i = 0; i < n; ++i)
+    {
+        airv::calc::WindData wind =
+            airv::calc::calculate_wind_vector(vary(i, 250.0, 0.5), 245.0, vary(i, 90.0, 1.0), 95.0, 0.01);
+        sum += wind.speed_kts + wind.headwind;
+    }
+    keep(sum);
+}
+
+void bench_wind_components(int64_t n)
+{
+    double sum = 0.0;
+    for (int64_t i = 0; i < n; ++i)
+    {
+        airv::calc::WindComponents comp = airv::calc::calculate_wind(vary(i, 90.0, 1.0), 85.0, 270.0, 15.0);
+        sum += comp.headwind + comp.crosswind;
+    }
+    keep(sum);
+}
+
+void bench_envelope(int64_t n)
+{
+    double sum = 0.0;
+    for (int64_t i = 0; i < n; ++i)
+    {
+        airv::calc::EnvelopeMargins env =
+            airv::calc::calculate_envelope(vary(i, 5.0, 0.25), 220.0, 0.65, 120.0, 250.0, 0.82);
+        sum += env.min_margin_pct;
+    }
+    keep(sum);
+}
+
+void bench_energy(int64_t n)
+{
+    double sum = 0.0;
+    for (int64_t i = 0; i < n; ++i)
+    {
+        airv::calc::EnergyData energy = airv::calc::calculate_energy(vary(i, 250.0, 0.5), 35000.0, -500.0);
+        sum += energy.specific_energy_ft;
+    }
+    keep(sum);
+}
+
+void bench_glide_reach(int64_t n)
+{
+    double sum = 0.0;
+    for (int64_t i = 0; i < n; ++i)
+    {
+        airv::calc::GlideData glide = airv::calc::calculate_glide_reach(vary(i, 35000.0, 10.0), 250.0, 8.0);
+        sum += glide.wind_adjusted_range_nm;
+    }
+    keep(sum);
+}
+
+void bench_turn_performance(int64_t n)
+{
+    double sum = 0.0;
+    for (int64_t i = 0; i < n; ++i)
+    {
+        airv::calc::TurnData turn = airv::calc::calculate_turn_performance(vary(i, 250.0, 0.5), 25.0, 90.0);
+        sum += turn.radius_nm + turn.turn_rate_dps;
+    }
+    keep(sum);
+}
+
+void bench_vnav(int64_t n)
+{
+    double sum = 0.0;
+    for (int64_t i = 0; i < n; ++i)
+    {
+        airv::calc::VNAVData vnav =
+            airv::calc::calculate_vnav(vary(i, 35000.0, 10.0), 10000.0, 100.0, 450.0, -1500.0);
+        sum += vnav.required_vs_fpm;
+    }
+    keep(sum);
+}
+
+void bench_density_altitude(int64_t n)
+{
+    double sum = 0.0;
+    for (int64_t i = 0; i < n; ++i)
+    {
+        airv::calc::DensityAltitudeData da =
+            airv::calc::calculate_density_altitude_data(vary(i, 5000.0, 25.0), 25.0, 150.0, 170.0);
+        sum += da.density_altitude_ft + da.air_density_ratio;
+    }
+    keep(sum);
+}
+
+void bench_density_altitude_exact(int64_t n)
+{
+    double sum = 0.0;
+    for (int64_t i = 0; i < n; ++i)
+    {
+        airv::calc::DensityAltitudeData da =
+            airv::calc::calculate_density_altitude_data(vary(i, 5000.0, 25.0), 25.0, 150.0, 170.0, true);
+        sum += da.density_altitude_ft + da.air_density_ratio;
+    }
+    keep(sum);
+}
+
+void bench_json_serialization(int64_t n)
+{
+    static char buffer[airv::json::default_buffer_size];
+    double sum = 0.0;
+
+    for (int64_t i = 0; i < n; ++i)
+    {
+        airv::json::Writer writer(buffer, sizeof(buffer));
+
+        writer.open_object();
+        writer.open_object("wind");
+        writer.field("speed_kts", vary(i, 12.0, 0.1));
+        writer.field("direction_from", 243.43);
+        writer.field("headwind", 8.43);
+        writer.field("crosswind", -5.33);
+        writer.field("gust_factor", 0.01);
+        writer.close_object();
+        writer.open_object("envelope");
+        writer.field("stall_margin_pct", 82.98);
+        writer.field("vmo_margin_pct", 12.00);
+        writer.field("mmo_margin_pct", 20.73);
+        writer.field("min_margin_pct", 12.00);
+        writer.field("load_factor", 1.00);
+        writer.field("corner_speed_kts", 170.05);
+        writer.close_object();
+        writer.close_object();
+
+        sum += static_cast<double>(writer.length());
+    }
+    keep(sum);
+}
+
+// Full 256-radial glide ring sweep; reported per ring
+void bench_glide_ring_256(int64_t n)
+{
+    static airv::calc::RadialTable table;
+    static airv::calc::GlideRing ring;
+
+    airv::calc::build_radial_table(airv::calc::max_glide_radials, table);
+
+    airv::calc::WindData wind;
+    wind.speed_kts      = 22.16;
+    wind.direction_from = 195.53;
+
+    double sum = 0.0;
+    for (int64_t i = 0; i < n; ++i)
+    {
+        airv::calc::calculate_glide_ring(table, vary(i, 35000.0, 100.0), 250.0, wind, ring);
+        sum += ring.range_nm[0];
+    }
+    keep(sum);
+}
+
+// 128-point turn arc polyline; reported per arc
+void bench_turn_arc_128(int64_t n)
+{
+    static airv::calc::TurnArc arc;
+
+    airv::calc::TurnData turn = airv::calc::calculate_turn_performance(250.0, 25.0, 90.0);
+
+    double sum = 0.0;
+    for (int64_t i = 0; i < n; ++i)
+    {
+        airv::calc::calculate_turn_arc(turn, vary(i, 90.0, 1.0), 90.0, airv::calc::max_arc_points, arc);
+        sum += arc.east_nm[airv::calc::max_arc_points - 1];
+    }
+    keep(sum);
+}
+
+// AoS double envelope batch over one chunk; reported per sample
+void bench_envelope_batch_f64(int64_t n)
+{
+    static airv::batch::Sample samples[airv::batch::chunk_size];
+    static airv::calc::EnvelopeMargins envelopes[airv::batch::chunk_size];
+
+    for (size_t i = 0; i < airv::batch::chunk_size; ++i)
+    {
+        samples[i].ias_kts  = vary(static_cast<int64_t>(i), 220.0, 0.25);
+        samples[i].mach     = 0.65;
+        samples[i].bank_deg = vary(static_cast<int64_t>(i), 5.0, 0.25);
+        samples[i].vso_kts  = 120.0;
+        samples[i].vne_kts  = 250.0;
+        samples[i].mmo      = 0.82;
+    }
+
+    double sum      = 0.0;
+    size_t chunk    = bench_chunk_size;
+    int64_t batches = (n + static_cast<int64_t>(chunk) - 1) / static_cast<int64_t>(chunk);
+
+    for (int64_t b = 0; b < batches; ++b)
+    {
+        airv::simd::calculate_envelope_batch(samples, chunk, envelopes);
+        sum += envelopes[0].min_margin_pct;
+    }
+    keep(sum);
+}
+
+// SoA float32 envelope batch over one chunk; reported per sample
+void bench_envelope_block_f32(int64_t n)
+{
+    static airv::batch::SampleBlockF32 block;
+    static airv::batch::EnvelopeBlockF32 envelopes;
+
+    for (size_t i = 0; i < airv::batch::chunk_size; ++i)
+    {
+        block.ias_kts[i]  = static_cast<float>(vary(static_cast<int64_t>(i), 220.0, 0.25));
+        block.mach[i]     = 0.65F;
+        block.bank_deg[i] = static_cast<float>(vary(static_cast<int64_t>(i), 5.0, 0.25));
+        block.vso_kts[i]  = 120.0F;
+        block.vne_kts[i]  = 250.0F;
+        block.mmo[i]      = 0.82F;
+    }
+
+    double sum      = 0.0;
+    size_t chunk    = bench_chunk_size;
+    int64_t batches = (n + static_cast<int64_t>(chunk) - 1) / static_cast<int64_t>(chunk);
+
+    for (int64_t b = 0; b < batches; ++b)
+    {
+        airv::simd::calculate_envelope_block_f32(block, chunk, envelopes);
+        sum += static_cast<double>(envelopes.min_margin_pct[0]);
+    }
+    keep(sum);
+}
+
+// Full SIMD flight batch over one chunk; reported per sample
+void bench_flight_batch_simd(int64_t n)
+{
+    static airv::batch::Sample samples[airv::batch::chunk_size];
+    static airv::calc::WindData winds[airv::batch::chunk_size];
+    static airv::calc::EnvelopeMargins envelopes[airv::batch::chunk_size];
+    static airv::calc::SensorHistoryBuffer ias_buffer;
+
+    for (size_t i = 0; i < airv::batch::chunk_size; ++i)
+    {
+        samples[i].tas_kts     = vary(static_cast<int64_t>(i), 250.0, 0.5);
+        samples[i].gs_kts      = 245.0;
+        samples[i].heading_deg = vary(static_cast<int64_t>(i), 90.0, 1.0);
+        samples[i].track_deg   = 95.0;
+        samples[i].ias_kts     = vary(static_cast<int64_t>(i), 220.0, 0.25);
+        samples[i].mach        = 0.65;
+        samples[i].bank_deg    = 5.0;
+        samples[i].vso_kts     = 120.0;
+        samples[i].vne_kts     = 250.0;
+        samples[i].mmo         = 0.82;
+    }
+
+    double sum      = 0.0;
+    size_t chunk    = bench_chunk_size;
+    int64_t batches = (n + static_cast<int64_t>(chunk) - 1) / static_cast<int64_t>(chunk);
+
+    for (int64_t b = 0; b < batches; ++b)
+    {
+        airv::simd::calculate_wind_vector_batch(samples, chunk, winds, ias_buffer);
+        airv::simd::calculate_envelope_batch(samples, chunk, envelopes);
+        sum += winds[0].speed_kts + envelopes[0].min_margin_pct;
+    }
+    keep(sum);
+}
+
+}  // namespace
+
+int main(void)
+{
+    BenchResult results[max_benchmarks];
+    int32_t count = 0;
+
+    results[count++] = run_benchmark("wind_vector", bench_wind_vector);
+    results[count++] = run_benchmark("wind_components", bench_wind_components);
+    results[count++] = run_benchmark("envelope", bench_envelope);
+    results[count++] = run_benchmark("energy", bench_energy);
+    results[count++] = run_benchmark("glide_reach", bench_glide_reach);
+    results[count++] = run_benchmark("turn_performance", bench_turn_performance);
+    results[count++] = run_benchmark("vnav", bench_vnav);
+    results[count++] = run_benchmark("density_altitude", bench_density_altitude);
+    results[count++] = run_benchmark("density_altitude_exact", bench_density_altitude_exact);
+    results[count++] = run_benchmark("json_serialization", bench_json_serialization);
+    results[count++] = run_benchmark("flight_batch_simd_per_sample", bench_flight_batch_simd);
+    results[count++] = run_benchmark("envelope_batch_f64_aos", bench_envelope_batch_f64);
+    results[count++] = run_benchmark("envelope_block_f32_soa", bench_envelope_block_f32);
+    results[count++] = run_benchmark("glide_ring_256_per_ring", bench_glide_ring_256);
+    results[count++] = run_benchmark("turn_arc_128_per_arc", bench_turn_arc_128);
+
+    // Human-readable table
+    fprintf(stderr, "%-30s %12s %14s\n", "benchmark", "ns/op", "iterations");
+    for (int32_t i = 0; i < count; ++i)
+    {
+        fprintf(stderr,
+                "%-30s %12.2f %14lld\n",
+                results[i].name,
+                results[i].ns_per_op,
+                static_cast<long long>(results[i].iterations));
+    }
+
+    // Machine-readable document for release-over-release tracking
+    static char buffer[airv::json::default_buffer_size];
+    airv::json::Writer writer(buffer, sizeof(buffer));
+
+    writer.open_object();
+    writer.field("simd_avx2", airv::simd::avx2_available() ? "yes" : "no");
+    writer.open_array("benchmarks");
+    for (int32_t i = 0; i < count; ++i)
+    {
+        writer.open_object();
+        writer.field("name", results[i].name);
+        writer.field("ns_per_op", results[i].ns_per_op);
+        writer.field("iterations", static_cast<uint64_t>(results[i].iterations));
+        writer.close_object();
+    }
+    writer.close_array();
+    writer.close_object();
+
+    fwrite(writer.data(), 1, writer.length(), stdout);
+
+    return static_cast<int>(airv::Return_code::success);
+}
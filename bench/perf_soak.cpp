@@ -0,0 +1,425 @@
+// Soak-test harness for the X-Plane MFD calculation daemon
+// JSF AV C++ Coding Standard Compliant Version
+//
+// `make test` proves the numbers are right; nothing proved they stay
+// fast.  This harness spawns the real daemon, drives every single-line
+// request type through its pipes flat out (many multiples of the 10 Hz
+// simulator rate) for a fixed window each, and measures per-frame
+// round-trip latency, throughput, and the daemon's peak RSS.  Results
+// are gated against the checked-in budgets in tests/perf_budgets.txt;
+// any command over budget fails the build.  Inputs vary per frame so
+// caches and dead bands cannot trivialize the work.
+//
+// Human-readable results go to stderr; stdout carries one JSON document
+// for tracking across releases:
+//
+//   make perftest
+
+#include "json_writer.h"
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace
+{
+
+// Soak window per command; long enough for stable percentiles
+constexpr int64_t soak_ns_per_command = 1000000000;  // 1 s
+
+// Latency sample cap per command; qsort'ed for percentiles
+constexpr int32_t max_samples = 262144;
+
+constexpr int32_t max_line_length  = 512;
+constexpr int32_t max_commands     = 16;
+constexpr double ns_per_us         = 1000.0;
+constexpr int32_t p99_numerator    = 99;
+constexpr int32_t percent_divisor  = 100;
+
+// One request generator; inputs walk with the frame index so dead bands
+// and caches see fresh values
+typedef void (*FormatFn)(char* line,
+                         size_t capacity,
+                         int64_t frame);
+
+void format_wind(char* line, size_t capacity, int64_t frame)
+{
+    snprintf(line, capacity, "wind %f %f %f %f\n", 90.0 + (frame % 20) * 0.1, 85.0,
+             120.0 + (frame % 30) * 0.2, 15.0 + (frame % 10) * 0.1);
+}
+
+void format_flight(char* line, size_t capacity, int64_t frame)
+{
+    snprintf(line, capacity,
+             "flight %f 245 90 95 %f 0.65 35000 35000 -500 75000 %f 120 250 0.82\n",
+             250.0 + (frame % 40) * 0.1, 220.0 + (frame % 25) * 0.1, 5.0 + (frame % 15) * 0.1);
+}
+
+void format_turn(char* line, size_t capacity, int64_t frame)
+{
+    snprintf(line, capacity, "turn %f %f 90\n", 250.0 + (frame % 40) * 0.1,
+             20.0 + (frame % 10) * 0.5);
+}
+
+void format_vnav(char* line, size_t capacity, int64_t frame)
+{
+    snprintf(line, capacity, "vnav %f 10000 100 450 -1500\n", 35000.0 - (frame % 100) * 1.0);
+}
+
+void format_density(char* line, size_t capacity, int64_t frame)
+{
+    snprintf(line, capacity, "density %f %f 150 170\n", 5000.0 + (frame % 50) * 1.0,
+             25.0 + (frame % 10) * 0.1);
+}
+
+void format_ring(char* line, size_t capacity, int64_t frame)
+{
+    snprintf(line, capacity, "ring 95 %f 0 0 %f\n", 90.0 + (frame % 10) * 0.1,
+             8000.0 + (frame % 20) * 1.0);
+}
+
+void format_arc(char* line, size_t capacity, int64_t frame)
+{
+    snprintf(line, capacity, "arc 120 %f 90 0 64\n", 20.0 + (frame % 10) * 0.5);
+}
+
+struct CommandSpec
+{
+    const char* name;
+    FormatFn format;
+};
+
+const CommandSpec command_specs[] = {
+    {"wind", format_wind},       {"flight", format_flight}, {"turn", format_turn},
+    {"vnav", format_vnav},       {"density", format_density}, {"ring", format_ring},
+    {"arc", format_arc},
+};
+
+constexpr int32_t command_count = sizeof(command_specs) / sizeof(command_specs[0]);
+
+// Latency budgets for one command, microseconds
+struct Budget
+{
+    char name[32];
+    double p50_us;
+    double p99_us;
+    double max_us;
+};
+
+struct BudgetSet
+{
+    Budget commands[max_commands];
+    int32_t count;
+    double throughput_min_fps;  // Floor across every command
+    double rss_max_kb;          // Daemon peak RSS ceiling
+};
+
+// Measured soak results for one command
+struct SoakResult
+{
+    const char* name;
+    int64_t frames;
+    double p50_us;
+    double p99_us;
+    double max_us;
+    double throughput_fps;
+};
+
+int64_t now_ns()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (static_cast<int64_t>(now.tv_sec) * 1000000000) + now.tv_nsec;
+}
+
+int compare_u64(const void* a,
+                const void* b)
+{
+    uint64_t lhs = *static_cast<const uint64_t*>(a);
+    uint64_t rhs = *static_cast<const uint64_t*>(b);
+    return (lhs < rhs) ? -1 : (lhs > rhs) ? 1 : 0;
+}
+
+// Budgets file: '# comment', 'throughput_min_fps <v>', 'rss_max_kb <v>',
+// or '<command> <p50_us> <p99_us> <max_us>'
+bool load_budgets(const char* path,
+                  BudgetSet& budgets)
+{
+    budgets.count              = 0;
+    budgets.throughput_min_fps = 0.0;
+    budgets.rss_max_kb         = 0.0;
+
+    FILE* file = fopen(path, "r");
+    bool ok    = (file != nullptr);
+
+    if (ok)
+    {
+        char line[max_line_length];
+
+        while (fgets(line, sizeof(line), file) != nullptr)
+        {
+            Budget entry;
+            double value = 0.0;
+
+            if (line[0] == '#' || line[0] == '\n')
+            {
+                // Comment or blank
+            }
+            else if (sscanf(line, "throughput_min_fps %lf", &value) == 1)
+            {
+                budgets.throughput_min_fps = value;
+            }
+            else if (sscanf(line, "rss_max_kb %lf", &value) == 1)
+            {
+                budgets.rss_max_kb = value;
+            }
+            else if (budgets.count < max_commands &&
+                     sscanf(line, "%31s %lf %lf %lf", entry.name, &entry.p50_us, &entry.p99_us,
+                            &entry.max_us) == 4)
+            {
+                budgets.commands[budgets.count] = entry;
+                ++budgets.count;
+            }
+        }
+        fclose(file);
+    }
+
+    return ok;
+}
+
+const Budget* find_budget(const BudgetSet& budgets,
+                          const char* name)
+{
+    const Budget* result = nullptr;
+
+    for (int32_t i = 0; result == nullptr && i < budgets.count; ++i)
+    {
+        if (strcmp(budgets.commands[i].name, name) == 0)
+        {
+            result = &budgets.commands[i];
+        }
+    }
+
+    return result;
+}
+
+// Read one reply frame (JSON lines up to the blank terminator)
+bool read_reply(FILE* from_daemon)
+{
+    char line[max_line_length];
+    bool terminated = false;
+    bool alive      = true;
+
+    while (alive && !terminated)
+    {
+        alive = (fgets(line, sizeof(line), from_daemon) != nullptr);
+        if (alive && line[0] == '\n')
+        {
+            terminated = true;
+        }
+    }
+
+    return terminated;
+}
+
+// Latency samples live here; one command at a time uses the array
+uint64_t latency_ns[max_samples];
+
+// Drive one command flat out for the soak window
+bool soak_command(const CommandSpec& spec,
+                  FILE* to_daemon,
+                  FILE* from_daemon,
+                  SoakResult& result)
+{
+    char line[max_line_length];
+    int64_t start   = now_ns();
+    int64_t elapsed = 0;
+    int32_t samples = 0;
+    bool ok         = true;
+
+    while (ok && elapsed < soak_ns_per_command && samples < max_samples)
+    {
+        spec.format(line, sizeof(line), samples);
+
+        int64_t t0 = now_ns();
+        fputs(line, to_daemon);
+        fflush(to_daemon);
+        ok = read_reply(from_daemon);
+        int64_t t1 = now_ns();
+
+        latency_ns[samples] = static_cast<uint64_t>(t1 - t0);
+        ++samples;
+        elapsed = t1 - start;
+    }
+
+    if (ok && samples > 0)
+    {
+        qsort(latency_ns, static_cast<size_t>(samples), sizeof(uint64_t), compare_u64);
+
+        result.name   = spec.name;
+        result.frames = samples;
+        result.p50_us = static_cast<double>(latency_ns[samples / 2]) / ns_per_us;
+        result.p99_us =
+            static_cast<double>(latency_ns[(samples * p99_numerator) / percent_divisor]) / ns_per_us;
+        result.max_us         = static_cast<double>(latency_ns[samples - 1]) / ns_per_us;
+        result.throughput_fps = static_cast<double>(samples) * 1.0e9 / static_cast<double>(elapsed);
+    }
+
+    return ok && samples > 0;
+}
+
+}  // namespace
+
+int main(int argc,
+         char* argv[])
+{
+    if (argc != 3)
+    {
+        fprintf(stderr, "Usage: perf_soak <daemon_path> <budgets_path>\n");
+        return 1;
+    }
+
+    BudgetSet budgets;
+    if (!load_budgets(argv[2], budgets))
+    {
+        fprintf(stderr, "Error: Cannot read budgets %s\n", argv[2]);
+        return 1;
+    }
+
+    int to_child[2];
+    int from_child[2];
+    if (pipe(to_child) != 0 || pipe(from_child) != 0)
+    {
+        fprintf(stderr, "Error: Cannot create pipes\n");
+        return 1;
+    }
+
+    pid_t child = fork();
+    if (child < 0)
+    {
+        fprintf(stderr, "Error: Cannot fork daemon\n");
+        return 1;
+    }
+    if (child == 0)
+    {
+        dup2(to_child[0], STDIN_FILENO);
+        dup2(from_child[1], STDOUT_FILENO);
+        close(to_child[0]);
+        close(to_child[1]);
+        close(from_child[0]);
+        close(from_child[1]);
+        execl(argv[1], argv[1], static_cast<char*>(nullptr));
+        _exit(127);
+    }
+
+    close(to_child[0]);
+    close(from_child[1]);
+    FILE* to_daemon   = fdopen(to_child[1], "w");
+    FILE* from_daemon = fdopen(from_child[0], "r");
+    if (to_daemon == nullptr || from_daemon == nullptr)
+    {
+        fprintf(stderr, "Error: Cannot open daemon pipes\n");
+        return 1;
+    }
+
+    SoakResult results[command_count];
+    bool ok = true;
+
+    for (int32_t i = 0; ok && i < command_count; ++i)
+    {
+        ok = soak_command(command_specs[i], to_daemon, from_daemon, results[i]);
+        if (!ok)
+        {
+            fprintf(stderr, "Error: Daemon died during %s soak\n", command_specs[i].name);
+        }
+    }
+
+    fputs("quit\n", to_daemon);
+    fflush(to_daemon);
+    fclose(to_daemon);
+    fclose(from_daemon);
+
+    int status = 0;
+    waitpid(child, &status, 0);
+
+    struct rusage usage;
+    getrusage(RUSAGE_CHILDREN, &usage);
+    double rss_kb = static_cast<double>(usage.ru_maxrss);
+
+    // Gate against the budgets and report
+    int32_t violations = 0;
+
+    fprintf(stderr, "%-10s %10s %10s %10s %10s %12s\n", "command", "frames", "p50_us", "p99_us",
+            "max_us", "frames_per_s");
+    for (int32_t i = 0; ok && i < command_count; ++i)
+    {
+        const SoakResult& r     = results[i];
+        const Budget* budget    = find_budget(budgets, r.name);
+        const char* verdict     = "";
+
+        if (budget == nullptr)
+        {
+            verdict = "  NO BUDGET";
+            ++violations;
+        }
+        else if (r.p50_us > budget->p50_us || r.p99_us > budget->p99_us ||
+                 r.max_us > budget->max_us)
+        {
+            verdict = "  OVER BUDGET";
+            ++violations;
+        }
+        if (budgets.throughput_min_fps > 0.0 && r.throughput_fps < budgets.throughput_min_fps)
+        {
+            verdict = "  UNDER THROUGHPUT";
+            ++violations;
+        }
+
+        fprintf(stderr, "%-10s %10lld %10.1f %10.1f %10.1f %12.0f%s\n", r.name,
+                static_cast<long long>(r.frames), r.p50_us, r.p99_us, r.max_us, r.throughput_fps,
+                verdict);
+    }
+    fprintf(stderr, "daemon peak RSS: %.0f KB\n", rss_kb);
+    if (budgets.rss_max_kb > 0.0 && rss_kb > budgets.rss_max_kb)
+    {
+        fprintf(stderr, "RSS OVER BUDGET (limit %.0f KB)\n", budgets.rss_max_kb);
+        ++violations;
+    }
+
+    // JSON document on stdout for tracking across releases
+    if (ok)
+    {
+        static char buffer[airv::json::default_buffer_size];
+        airv::json::Writer writer(buffer, sizeof(buffer));
+
+        writer.open_object();
+        writer.open_array("commands");
+        for (int32_t i = 0; i < command_count; ++i)
+        {
+            writer.open_object();
+            writer.field("name", results[i].name);
+            writer.field("frames", static_cast<uint64_t>(results[i].frames));
+            writer.field("p50_us", results[i].p50_us);
+            writer.field("p99_us", results[i].p99_us);
+            writer.field("max_us", results[i].max_us);
+            writer.field("throughput_fps", results[i].throughput_fps);
+            writer.close_object();
+        }
+        writer.close_array();
+        writer.field("rss_kb", rss_kb);
+        writer.field("violations", violations);
+        writer.close_object();
+        fwrite(writer.data(), 1, writer.length(), stdout);
+    }
+
+    if (violations > 0)
+    {
+        fprintf(stderr, "perftest: %d budget violation(s)\n", violations);
+    }
+
+    return (ok && violations == 0) ? 0 : 1;
+}
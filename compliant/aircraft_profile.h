@@ -0,0 +1,252 @@
+// Compile-time aircraft performance profiles for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// The generic envelope/glide/turn kernels receive vso/vne/mmo as runtime
+// doubles on every call, and the glide core falls back to one
+// typical_glide_ratio for everything.  Here each supported type is a tag
+// struct of constexpr constants (limits, glide polar, flap-dependent stall
+// schedule) and the kernels are function templates over that tag, so the
+// per-type constants, derived values such as vso * sqrt(2), and the flap
+// table lookups fold at compile time.  The daemon selects a profile once at
+// startup (see find_profile) and the hot loop then runs the specialized
+// instantiation with no per-call parameter traffic.
+
+#ifndef AIRCRAFT_PROFILE
+#define AIRCRAFT_PROFILE
+
+#include "flight_calc.h"
+#include "turn_calc.h"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace airv
+{
+namespace prof
+{
+
+// One point of a flap-dependent stall schedule
+struct FlapStallEntry
+{
+    double flap_deg;  // Flap deflection (deg)
+    double vso_kts;   // Stall speed at that deflection (knots IAS)
+};
+
+// Cessna 172S
+struct C172
+{
+    static constexpr const char* designator = "c172";
+    static constexpr double vso_kts         = 40.0;   // Full-flap stall
+    static constexpr double vne_kts         = 163.0;
+    static constexpr double mmo             = 0.50;   // Never a limit for this type
+    static constexpr double glide_ratio     = 9.0;
+    static constexpr double best_glide_kts  = 68.0;
+    static constexpr double max_bank_deg    = 60.0;
+
+    static constexpr int32_t flap_stall_count = 3;
+    static constexpr FlapStallEntry flap_stall(int32_t i)
+    {
+        return (i == 0) ? FlapStallEntry{0.0, 48.0}
+             : (i == 1) ? FlapStallEntry{10.0, 44.0}
+                        : FlapStallEntry{30.0, 40.0};
+    }
+};
+
+// Cirrus SR22
+struct SR22
+{
+    static constexpr const char* designator = "sr22";
+    static constexpr double vso_kts         = 59.0;
+    static constexpr double vne_kts         = 201.0;
+    static constexpr double mmo             = 0.50;
+    static constexpr double glide_ratio     = 8.8;
+    static constexpr double best_glide_kts  = 88.0;
+    static constexpr double max_bank_deg    = 60.0;
+
+    static constexpr int32_t flap_stall_count = 3;
+    static constexpr FlapStallEntry flap_stall(int32_t i)
+    {
+        return (i == 0) ? FlapStallEntry{0.0, 70.0}
+             : (i == 1) ? FlapStallEntry{16.0, 64.0}
+                        : FlapStallEntry{32.0, 59.0};
+    }
+};
+
+// Boeing 737-800
+struct B738
+{
+    static constexpr const char* designator = "b738";
+    static constexpr double vso_kts         = 108.0;  // Flaps 40, typical landing weight
+    static constexpr double vne_kts         = 340.0;  // Vmo
+    static constexpr double mmo             = 0.82;
+    static constexpr double glide_ratio     = 17.0;
+    static constexpr double best_glide_kts  = 210.0;
+    static constexpr double max_bank_deg    = 30.0;
+
+    static constexpr int32_t flap_stall_count = 3;
+    static constexpr FlapStallEntry flap_stall(int32_t i)
+    {
+        return (i == 0) ? FlapStallEntry{0.0, 160.0}
+             : (i == 1) ? FlapStallEntry{15.0, 130.0}
+                        : FlapStallEntry{40.0, 108.0};
+    }
+};
+
+// Stall speed at a flap setting: linear interpolation over the profile's
+// schedule.  The schedule is constexpr, so calls with a constant flap
+// setting fold to a constant.
+template <typename Profile>
+constexpr double vso_for_flap(double flap_deg)
+{
+    double result = Profile::flap_stall(0).vso_kts;
+
+    if (flap_deg >= Profile::flap_stall(Profile::flap_stall_count - 1).flap_deg)
+    {
+        result = Profile::flap_stall(Profile::flap_stall_count - 1).vso_kts;
+    }
+    else if (flap_deg > Profile::flap_stall(0).flap_deg)
+    {
+        for (int32_t i = 1; i < Profile::flap_stall_count; ++i)
+        {
+            FlapStallEntry lo = Profile::flap_stall(i - 1);
+            FlapStallEntry hi = Profile::flap_stall(i);
+
+            if (flap_deg <= hi.flap_deg)
+            {
+                double t = (flap_deg - lo.flap_deg) / (hi.flap_deg - lo.flap_deg);
+                result   = lo.vso_kts + (t * (hi.vso_kts - lo.vso_kts));
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+
+// Envelope margins for one type; the limit reciprocals and the flap stall
+// schedule are compile-time constants of the instantiation
+template <typename Profile>
+inline calc::EnvelopeMargins calculate_envelope_for(double bank_deg,  // Bank angle (deg)
+                                                    double ias_kts,   // Indicated airspeed (knots)
+                                                    double mach,      // Mach number
+                                                    double flap_deg)  // Flap deflection (deg)
+{
+    constexpr double inv_vne = 1.0 / Profile::vne_kts;
+    constexpr double inv_mmo = 1.0 / Profile::mmo;
+
+    calc::EnvelopeMargins result;
+
+    double bank_rad    = bank_deg * units::deg_to_rad;
+    result.load_factor = 1.0 / cos(bank_rad);
+
+    // Stall speed from the flap schedule, increased by load factor
+    double vs_actual        = vso_for_flap<Profile>(flap_deg) * sqrt(result.load_factor);
+    result.stall_margin_pct = ((ias_kts - vs_actual) / vs_actual) * 100.0;
+
+    result.vmo_margin_pct = (Profile::vne_kts - ias_kts) * inv_vne * 100.0;
+    result.mmo_margin_pct = (Profile::mmo - mach) * inv_mmo * 100.0;
+    result.min_margin_pct = std::min({result.stall_margin_pct, result.vmo_margin_pct, result.mmo_margin_pct});
+
+    result.corner_speed_kts = vs_actual * calc::sqrt_two;  // Vc is almost Vs * sqrt(2)
+
+    return result;
+}
+
+// Glide reach for one type; uses the type's real polar instead of the
+// generic typical_glide_ratio / typical_vs assumptions
+template <typename Profile>
+inline calc::GlideData calculate_glide_reach_for(double agl_ft,
+                                                 double tas_kts,
+                                                 double headwind_kts)
+{
+    constexpr double range_nm_per_ft = Profile::glide_ratio / units::nm_to_ft;
+
+    calc::GlideData result;
+
+    result.glide_ratio        = Profile::glide_ratio;
+    result.still_air_range_nm = agl_ft * range_nm_per_ft;
+
+    double wind_effect            = headwind_kts / tas_kts;
+    result.wind_adjusted_range_nm = result.still_air_range_nm * (1.0 - wind_effect);
+
+    result.best_glide_speed_kts = Profile::best_glide_kts;
+
+    return result;
+}
+
+// Turn performance for one type; the commanded bank is clamped to the
+// type's operational bank limit before the generic math runs
+template <typename Profile>
+inline calc::TurnData calculate_turn_for(double tas_kts,
+                                         double bank_deg,
+                                         double course_change_deg)
+{
+    double clamped = bank_deg;
+
+    if (clamped > Profile::max_bank_deg)
+    {
+        clamped = Profile::max_bank_deg;
+    }
+    if (clamped < -Profile::max_bank_deg)
+    {
+        clamped = -Profile::max_bank_deg;
+    }
+
+    return calc::calculate_turn_performance(tas_kts, clamped, course_change_deg);
+}
+
+// Specialized kernel set for one type, bound once at startup.  After
+// selection every call goes through one indirect jump straight into the
+// folded instantiation.
+struct ProfileKernels
+{
+    const char* designator;
+    calc::EnvelopeMargins (*envelope)(double bank_deg,
+                                      double ias_kts,
+                                      double mach,
+                                      double flap_deg);
+    calc::GlideData (*glide)(double agl_ft,
+                             double tas_kts,
+                             double headwind_kts);
+    calc::TurnData (*turn)(double tas_kts,
+                           double bank_deg,
+                           double course_change_deg);
+};
+
+template <typename Profile>
+constexpr ProfileKernels kernels_for()
+{
+    return ProfileKernels{Profile::designator,
+                          &calculate_envelope_for<Profile>,
+                          &calculate_glide_reach_for<Profile>,
+                          &calculate_turn_for<Profile>};
+}
+
+constexpr int32_t profile_count = 3;
+
+// Kernel set for a designator, or nullptr when the type is unknown
+inline const ProfileKernels* find_profile(const char* designator)
+{
+    static const ProfileKernels registry[profile_count] = {
+        kernels_for<C172>(),
+        kernels_for<SR22>(),
+        kernels_for<B738>(),
+    };
+
+    const ProfileKernels* result = nullptr;
+
+    for (int32_t i = 0; result == nullptr && i < profile_count; ++i)
+    {
+        if (strcmp(registry[i].designator, designator) == 0)
+        {
+            result = &registry[i];
+        }
+    }
+
+    return result;
+}
+
+}  // namespace prof
+}  // namespace airv
+
+#endif  // !AIRCRAFT_PROFILE
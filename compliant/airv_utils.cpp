@@ -0,0 +1,40 @@
+// Shared utility implementations for X-Plane MFD calculators
+// JSF AV C++ Coding Standard Compliant Version
+//
+// Compiled once into libairv.a so every calculator and the daemon link the
+// same code instead of each translation unit carrying its own copy.
+
+#include "xplane_mfd_calc.h"
+#include <cstdint>
+#include <cstdlib>
+
+namespace airv
+{
+namespace utils
+{
+
+// Converts a string to a double
+bool parse_double(const char* str,  // Input string
+                  double& result)   // Converted double
+{
+    char* end = nullptr;
+    result    = strtod(str, &end);
+    return (end != str && *end == '\0');
+}
+
+// Converts a string to an int
+bool parse_int32(const char* str,  // Input string
+                 int32_t& result)  // Converted int
+{
+    char* end  = nullptr;
+    long value = strtol(str, &end, 10);
+    if (end != str && *end == '\0')
+    {
+        result = static_cast<int32_t>(value);
+        return true;
+    }
+    return false;
+}
+
+}  // namespace utils
+}  // namespace airv
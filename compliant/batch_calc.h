@@ -0,0 +1,282 @@
+// Batch evaluation API for X-Plane MFD calculators
+// JSF AV C++ Coding Standard Compliant Version
+//
+// Array-in/array-out entry points used by the flight-replay pipeline: one
+// process handles a whole file of recorded telemetry instead of one fork/exec
+// per sample, and the tight per-sample loops are plain enough for the
+// compiler to vectorize.
+//
+// File format for the --batch CLI mode: a raw array of the per-calculator
+// sample struct (packed doubles, native endianness, no header).  Results are
+// written the same way, one result struct per input record.
+
+#ifndef BATCH_CALC
+#define BATCH_CALC
+
+#include "density_altitude_calc.h"
+#include "flight_calc.h"
+#include "turn_calc.h"
+#include "vnav_calc.h"
+#include "wind_calc.h"
+#include "xplane_mfd_calc.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+namespace airv
+{
+namespace batch
+{
+
+// Samples are processed in fixed-size chunks so file driving needs no heap
+constexpr size_t chunk_size = 1024;
+
+// One recorded telemetry tick, matching the flight_calculator CLI inputs
+struct Sample
+{
+    double tas_kts;      // True airspeed (knots)
+    double gs_kts;       // Ground speed (knots)
+    double heading_deg;  // Heading (deg)
+    double track_deg;    // Ground track (deg)
+    double ias_kts;      // Indicated airspeed (knots)
+    double mach;         // Mach number
+    double altitude_ft;  // Altitude (feet)
+    double agl_ft;       // Above ground level (feet)
+    double vs_fpm;       // Vertical speed (feet/min)
+    double weight_kg;    // Aircraft weight (kg)
+    double bank_deg;     // Bank angle (deg)
+    double vso_kts;      // Stall speed in landing config (knots IAS)
+    double vne_kts;      // Velocity never exceed (knots IAS)
+    double mmo;          // Maximum operating Mach number
+};
+
+// All four flight calculator outputs for one sample
+struct FlightResult
+{
+    calc::WindData wind;
+    calc::EnvelopeMargins envelope;
+    calc::EnergyData energy;
+    calc::GlideData glide;
+};
+
+struct WindSample
+{
+    double track_deg;       // Ground track (degrees true)
+    double heading_deg;     // Aircraft heading (degrees)
+    double wind_dir_deg;    // Wind direction FROM (degrees)
+    double wind_speed_kts;  // Wind speed (knots)
+};
+
+struct TurnSample
+{
+    double tas_kts;            // True airspeed (knots)
+    double bank_deg;           // Bank angle (degrees)
+    double course_change_deg;  // Course change (degrees)
+};
+
+struct VNAVSample
+{
+    double current_alt_ft;   // Current altitude (feet)
+    double target_alt_ft;    // Target altitude (feet)
+    double distance_nm;      // Distance to constraint (nautical miles)
+    double groundspeed_kts;  // Groundspeed (knots)
+    double current_vs_fpm;   // Current vertical speed (feet per minute)
+};
+
+struct DensitySample
+{
+    double pressure_alt_ft;  // Pressure altitude (feet)
+    double oat_celsius;      // Outside air temperature (Celsius)
+    double ias_kts;          // Indicated airspeed (knots)
+    double tas_kts;          // True airspeed (knots)
+};
+
+// Wind vectors over a telemetry stream.  The gust window is fed from the
+// stream's own IAS readings, exactly as the daemon feeds it frame by frame.
+inline void calculate_wind_vector_batch(const Sample* samples,
+                                        size_t count,
+                                        calc::WindData* results,
+                                        calc::SensorHistoryBuffer& ias_buffer)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        ias_buffer.add_reading(samples[i].ias_kts);
+        results[i] = calc::calculate_wind_vector(samples[i].tas_kts,
+                                                 samples[i].gs_kts,
+                                                 samples[i].heading_deg,
+                                                 samples[i].track_deg,
+                                                 ias_buffer.gust_factor());
+    }
+}
+
+inline void calculate_envelope_batch(const Sample* samples,
+                                     size_t count,
+                                     calc::EnvelopeMargins* results)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        results[i] = calc::calculate_envelope(samples[i].bank_deg,
+                                              samples[i].ias_kts,
+                                              samples[i].mach,
+                                              samples[i].vso_kts,
+                                              samples[i].vne_kts,
+                                              samples[i].mmo);
+    }
+}
+
+inline void calculate_energy_batch(const Sample* samples,
+                                   size_t count,
+                                   calc::EnergyData* results)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        results[i] = calc::calculate_energy(samples[i].tas_kts, samples[i].altitude_ft, samples[i].vs_fpm);
+    }
+}
+
+inline void calculate_glide_reach_batch(const Sample* samples,
+                                        size_t count,
+                                        const calc::WindData* winds,  // From calculate_wind_vector_batch
+                                        calc::GlideData* results)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        results[i] = calc::calculate_glide_reach(samples[i].agl_ft, samples[i].tas_kts, winds[i].headwind);
+    }
+}
+
+// Full flight calculator pass over one chunk of samples
+inline void calculate_flight_batch(const Sample* samples,
+                                   size_t count,
+                                   FlightResult* results,
+                                   calc::SensorHistoryBuffer& ias_buffer)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        ias_buffer.add_reading(samples[i].ias_kts);
+        results[i].wind     = calc::calculate_wind_vector(samples[i].tas_kts,
+                                                          samples[i].gs_kts,
+                                                          samples[i].heading_deg,
+                                                          samples[i].track_deg,
+                                                          ias_buffer.gust_factor());
+        results[i].envelope = calc::calculate_envelope(samples[i].bank_deg,
+                                                       samples[i].ias_kts,
+                                                       samples[i].mach,
+                                                       samples[i].vso_kts,
+                                                       samples[i].vne_kts,
+                                                       samples[i].mmo);
+        results[i].energy   = calc::calculate_energy(samples[i].tas_kts, samples[i].altitude_ft, samples[i].vs_fpm);
+        results[i].glide =
+            calc::calculate_glide_reach(samples[i].agl_ft, samples[i].tas_kts, results[i].wind.headwind);
+    }
+}
+
+inline void calculate_wind_batch(const WindSample* samples,
+                                 size_t count,
+                                 calc::WindComponents* results)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        results[i] = calc::calculate_wind(samples[i].track_deg,
+                                          samples[i].heading_deg,
+                                          samples[i].wind_dir_deg,
+                                          samples[i].wind_speed_kts);
+    }
+}
+
+inline void calculate_turn_performance_batch(const TurnSample* samples,
+                                             size_t count,
+                                             calc::TurnData* results)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        results[i] =
+            calc::calculate_turn_performance(samples[i].tas_kts, samples[i].bank_deg, samples[i].course_change_deg);
+    }
+}
+
+inline void calculate_vnav_batch(const VNAVSample* samples,
+                                 size_t count,
+                                 calc::VNAVData* results)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        results[i] = calc::calculate_vnav(samples[i].current_alt_ft,
+                                          samples[i].target_alt_ft,
+                                          samples[i].distance_nm,
+                                          samples[i].groundspeed_kts,
+                                          samples[i].current_vs_fpm);
+    }
+}
+
+inline void calculate_density_altitude_batch(const DensitySample* samples,
+                                             size_t count,
+                                             calc::DensityAltitudeData* results)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        results[i] = calc::calculate_density_altitude_data(samples[i].pressure_alt_ft,
+                                                           samples[i].oat_celsius,
+                                                           samples[i].ias_kts,
+                                                           samples[i].tas_kts);
+    }
+}
+
+// Drive a batch function over a whole input file in fixed-size chunks.
+// Returns the processed record count, or -1 on any I/O failure.  Buffers are
+// function-local statics: fixed footprint, no heap, CLI use is single-threaded.
+template<typename SampleT, typename ResultT, typename BatchFn>
+int64_t run_batch_file(const char* input_path,   // Raw SampleT records
+                       const char* output_path,  // Raw ResultT records, one per input
+                       BatchFn batch_fn)         // void(const SampleT*, size_t, ResultT*)
+{
+    static SampleT samples[chunk_size];
+    static ResultT results[chunk_size];
+
+    FILE* in = fopen(input_path, "rb");
+    if (in == nullptr)
+    {
+        return -1;
+    }
+    FILE* out = fopen(output_path, "wb");
+    if (out == nullptr)
+    {
+        fclose(in);
+        return -1;
+    }
+
+    int64_t total = 0;
+    bool ok       = true;
+
+    while (ok)
+    {
+        size_t got = fread(samples, sizeof(SampleT), chunk_size, in);
+        if (got == 0)
+        {
+            break;
+        }
+        batch_fn(samples, got, results);
+        if (fwrite(results, sizeof(ResultT), got, out) != got)
+        {
+            ok = false;
+        }
+        total += static_cast<int64_t>(got);
+    }
+
+    if (ferror(in) != 0)
+    {
+        ok = false;
+    }
+    fclose(in);
+    if (fclose(out) != 0)
+    {
+        ok = false;
+    }
+
+    return ok ? total : -1;
+}
+
+}  // namespace batch
+}  // namespace airv
+
+#endif  // !BATCH_CALC
@@ -0,0 +1,148 @@
+// Structure-of-arrays float32 batch layout for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// The batch API stores samples as arrays of double structs, so a SIMD
+// kernel gathers its lanes from strided fields and every load carries 15
+// significant digits of telemetry that the display rounds to two decimals
+// anyway.  This layout keeps one contiguous float array per field: vector
+// kernels get unit-stride full-width loads, twice the lanes per
+// instruction, and half the working set for million-sample replays.
+//
+// Blocks are fixed at the batch chunk size, so the replay driver's
+// chunking and no-heap rules carry over unchanged.  Double-precision AoS
+// remains the default and the reference path; float32 SoA is opt-in for
+// bulk replay where display-grade precision suffices.
+
+#ifndef BATCH_SOA
+#define BATCH_SOA
+
+#include "batch_calc.h"
+#include "flight_calc.h"
+#include "xplane_mfd_calc.h"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace airv
+{
+namespace batch
+{
+
+// One chunk of samples, one contiguous array per field
+struct SampleBlockF32
+{
+    float tas_kts[chunk_size];
+    float gs_kts[chunk_size];
+    float heading_deg[chunk_size];
+    float track_deg[chunk_size];
+    float ias_kts[chunk_size];
+    float mach[chunk_size];
+    float altitude_ft[chunk_size];
+    float agl_ft[chunk_size];
+    float vs_fpm[chunk_size];
+    float weight_kg[chunk_size];
+    float bank_deg[chunk_size];
+    float vso_kts[chunk_size];
+    float vne_kts[chunk_size];
+    float mmo[chunk_size];
+};
+
+// Envelope margins per sample, same field split
+struct EnvelopeBlockF32
+{
+    float stall_margin_pct[chunk_size];
+    float vmo_margin_pct[chunk_size];
+    float mmo_margin_pct[chunk_size];
+    float min_margin_pct[chunk_size];
+    float load_factor[chunk_size];
+    float corner_speed_kts[chunk_size];
+};
+
+// Energy state per sample
+struct EnergyBlockF32
+{
+    float specific_energy_ft[chunk_size];
+    float energy_rate_kts[chunk_size];
+    int32_t trend[chunk_size];
+};
+
+// Transpose one chunk of recorded AoS samples into the SoA block
+inline void transpose_samples(const Sample* samples,
+                              size_t count,
+                              SampleBlockF32& block)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        block.tas_kts[i]     = static_cast<float>(samples[i].tas_kts);
+        block.gs_kts[i]      = static_cast<float>(samples[i].gs_kts);
+        block.heading_deg[i] = static_cast<float>(samples[i].heading_deg);
+        block.track_deg[i]   = static_cast<float>(samples[i].track_deg);
+        block.ias_kts[i]     = static_cast<float>(samples[i].ias_kts);
+        block.mach[i]        = static_cast<float>(samples[i].mach);
+        block.altitude_ft[i] = static_cast<float>(samples[i].altitude_ft);
+        block.agl_ft[i]      = static_cast<float>(samples[i].agl_ft);
+        block.vs_fpm[i]      = static_cast<float>(samples[i].vs_fpm);
+        block.weight_kg[i]   = static_cast<float>(samples[i].weight_kg);
+        block.bank_deg[i]    = static_cast<float>(samples[i].bank_deg);
+        block.vso_kts[i]     = static_cast<float>(samples[i].vso_kts);
+        block.vne_kts[i]     = static_cast<float>(samples[i].vne_kts);
+        block.mmo[i]         = static_cast<float>(samples[i].mmo);
+    }
+}
+
+// Reference envelope pass over one SoA block.  Field-per-array loops with
+// no cross-iteration state; the compiler vectorizes them on any target.
+inline void calculate_envelope_block_f32_ref(const SampleBlockF32& block,
+                                             size_t count,
+                                             EnvelopeBlockF32& results)
+{
+    constexpr float deg_to_rad_f = static_cast<float>(units::deg_to_rad);
+    constexpr float sqrt_two_f   = static_cast<float>(calc::sqrt_two);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        float load      = 1.0F / cosf(block.bank_deg[i] * deg_to_rad_f);
+        float vs_actual = block.vso_kts[i] * sqrtf(load);
+
+        float stall = ((block.ias_kts[i] - vs_actual) / vs_actual) * 100.0F;
+        float vmo   = ((block.vne_kts[i] - block.ias_kts[i]) / block.vne_kts[i]) * 100.0F;
+        float mmo_m = ((block.mmo[i] - block.mach[i]) / block.mmo[i]) * 100.0F;
+
+        results.stall_margin_pct[i] = stall;
+        results.vmo_margin_pct[i]   = vmo;
+        results.mmo_margin_pct[i]   = mmo_m;
+        results.min_margin_pct[i]   = fminf(stall, fminf(vmo, mmo_m));
+        results.load_factor[i]      = load;
+        results.corner_speed_kts[i] = vs_actual * sqrt_two_f;
+    }
+}
+
+// Energy pass over one SoA block; plain per-field arithmetic
+inline void calculate_energy_block_f32(const SampleBlockF32& block,
+                                       size_t count,
+                                       EnergyBlockF32& results)
+{
+    constexpr float kts_to_ms_f      = static_cast<float>(units::kts_to_ms);
+    constexpr float ft_to_m_f        = static_cast<float>(units::ft_to_m);
+    constexpr float m_to_ft_f        = static_cast<float>(units::m_to_ft);
+    constexpr float inv_two_g_f      = static_cast<float>(1.0 / (2.0 * units::gravity));
+    constexpr float inv_rate_div_f   = static_cast<float>(1.0 / calc::energy_rate_divisor);
+    constexpr float trend_threshold  = static_cast<float>(calc::energy_trend_threshold);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        float v_ms    = block.tas_kts[i] * kts_to_ms_f;
+        float total_m = (block.altitude_ft[i] * ft_to_m_f) + (v_ms * v_ms * inv_two_g_f);
+
+        results.specific_energy_ft[i] = total_m * m_to_ft_f;
+        results.energy_rate_kts[i]    = block.vs_fpm[i] * inv_rate_div_f;
+        results.trend[i]              = (block.vs_fpm[i] > trend_threshold)    ? 1
+                                        : (block.vs_fpm[i] < -trend_threshold) ? -1
+                                                                               : 0;
+    }
+}
+
+}  // namespace batch
+}  // namespace airv
+
+#endif  // !BATCH_SOA
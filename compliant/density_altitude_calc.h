@@ -0,0 +1,169 @@
+// Density altitude calculation core for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// Shared between the density_altitude_calculator CLI and the mfd_calcd daemon.
+// Calculates density altitude and related atmospheric parameters:
+// - Density altitude (how "high" the aircraft performs)
+// - Pressure altitude
+// - True vs Equivalent airspeed conversions
+// - Air density ratio (sigma)
+// - Performance degradation percentage
+
+#ifndef DENSITY_ALTITUDE_CALC
+#define DENSITY_ALTITUDE_CALC
+
+#include "isa_table.h"
+#include "json_writer.h"
+#include "xplane_mfd_calc.h"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+
+namespace airv
+{
+namespace calc
+{
+
+// ISA model constants and altitude range live in isa_table.h with the table
+constexpr double density_alt_factor = 120.0;
+constexpr double min_ias_for_ratio  = 10.0;
+
+// Validation ranges: warning if input is not in range
+constexpr double min_temperature_c = -60.0;
+constexpr double max_temperature_c = 60.0;
+
+struct DensityAltitudeData
+{
+    double density_altitude_ft;      // Density altitude
+    double pressure_altitude_ft;     // Pressure altitude (from setting)
+    double air_density_ratio;        // ratio to sea level (sigma)
+    double temperature_deviation_c;  // Deviation from ISA
+    double performance_loss_pct;     // % performance loss vs sea level
+    double eas_kts;                  // Equivalent airspeed
+    double tas_to_ias_ratio;         // TAS/IAS ratio
+    double pressure_ratio;           // Pressure ratio vs sea level
+};
+
+// Calculate ISA temperature at given pressure altitude
+inline double isa_temperature_c(double pressure_altitude_ft,   // Pressure altitude (feet)
+                                bool exact_formulas = false)   // true: closed form instead of the table
+{
+    return exact_formulas ? sea_level_temp_c - (temp_lapse_rate * pressure_altitude_ft)
+                          : isa::temperature_c(pressure_altitude_ft);
+}
+
+// Pressure ratio vs sea level; the table avoids pow() on the hot path
+inline double calculate_pressure_ratio(double pressure_altitude_ft,
+                                       bool exact_formulas = false)
+{
+    return exact_formulas
+               ? pow(1.0 - pressure_altitude_constant * pressure_altitude_ft, pressure_altitude_exponent)
+               : isa::pressure_ratio(pressure_altitude_ft);
+}
+
+// Calculate density altitude using exact formula
+// DA = PA + [120 * (OAT - ISA)]
+inline double calculate_density_altitude(double pressure_altitude_ft,  // Pressure altitude (feet)
+                                         double oat_celsius,           // Outside air temperature (Celsius)
+                                         bool exact_formulas = false)
+{
+    // ISA temperature at pressure altitude
+    double isa_temp = isa_temperature_c(pressure_altitude_ft, exact_formulas);
+
+    // Temperature deviation from ISA
+    double temp_deviation = oat_celsius - isa_temp;
+
+    // Density altitude approximation (good to about 1% accuracy)
+    double density_altitude = pressure_altitude_ft + (density_alt_factor * temp_deviation);
+
+    return density_altitude;
+}
+
+// Calculate air density ratio (sigma)
+// sigma = rho / rho<sub>0</sub>
+inline double calculate_density_ratio(double pressure_altitude_ft,
+                                      double oat_celsius,
+                                      bool exact_formulas = false)
+{
+    // Convert to absolute temperature
+    double temp_k           = oat_celsius + kelvin_offset;
+    double sea_level_temp_k = sea_level_temp_c + kelvin_offset;
+
+    // Pressure ratio (using standard atmosphere)
+    double pressure_ratio = calculate_pressure_ratio(pressure_altitude_ft, exact_formulas);
+
+    // Temperature ratio
+    double temp_ratio = sea_level_temp_k / temp_k;
+
+    // Density ratio: sigma = (P/P<sub>0</sub>) * (T<sub>0</sub>/T)
+    double sigma = pressure_ratio * temp_ratio;
+
+    return sigma;
+}
+
+// Calculate Equivalent Airspeed (EAS)
+// EAS = TAS * sqrt(sigma)
+inline double calculate_eas(double tas_kts,
+                            double sigma)
+{
+    return tas_kts * sqrt(sigma);
+}
+
+// Calculate complete density altitude data
+inline DensityAltitudeData calculate_density_altitude_data(double pressure_altitude_ft,  // Pressure altitude (feet)
+                                                           double oat_celsius,  // Outside air temperature (Celsius)
+                                                           double ias_kts,      // Indicated airspeed (knots)
+                                                           double tas_kts,      // True airspeed (knots)
+                                                           bool exact_formulas = false)
+{
+    DensityAltitudeData result;
+
+    result.pressure_altitude_ft = pressure_altitude_ft;
+    result.density_altitude_ft  = calculate_density_altitude(pressure_altitude_ft, oat_celsius, exact_formulas);
+
+    // ISA temperature at this altitude
+    double isa_temp                = isa_temperature_c(pressure_altitude_ft, exact_formulas);
+    result.temperature_deviation_c = oat_celsius - isa_temp;
+
+    // Air density ratio
+    result.air_density_ratio = calculate_density_ratio(pressure_altitude_ft, oat_celsius, exact_formulas);
+
+    // Performance loss (inverse of density ratio)
+    result.performance_loss_pct = (1.0 - result.air_density_ratio) * 100.0;
+
+    // Equivalent airspeed
+    result.eas_kts = calculate_eas(tas_kts, result.air_density_ratio);
+
+    result.tas_to_ias_ratio = ias_kts > min_ias_for_ratio ? tas_kts / ias_kts : 1.0;
+
+    // Pressure ratio
+    result.pressure_ratio = calculate_pressure_ratio(pressure_altitude_ft, exact_formulas);
+
+    return result;
+}
+
+// Output results as JSON (fixed buffer, no iostream formatting state)
+inline void print_json(const DensityAltitudeData& da,
+                       FILE* out = stdout)  // Reply sink; the daemon redirects per client
+{
+    static char buffer[json::default_buffer_size];
+    json::Writer writer(buffer, sizeof(buffer));
+
+    writer.open_object();
+    writer.field("density_altitude_ft", da.density_altitude_ft);
+    writer.field("pressure_altitude_ft", da.pressure_altitude_ft);
+    writer.field("air_density_ratio", da.air_density_ratio);
+    writer.field("temperature_deviation_c", da.temperature_deviation_c);
+    writer.field("performance_loss_pct", da.performance_loss_pct);
+    writer.field("eas_kts", da.eas_kts);
+    writer.field("tas_to_ias_ratio", da.tas_to_ias_ratio);
+    writer.field("pressure_ratio", da.pressure_ratio);
+    writer.close_object();
+
+    fwrite(writer.data(), 1, writer.length(), out);
+}
+
+}  // namespace calc
+}  // namespace airv
+
+#endif  // !DENSITY_ALTITUDE_CALC
@@ -1,156 +1,19 @@
 // Density Altitude Calculator for X-Plane MFD
 // JSF AV C++ Coding Standard Compliant Version
 //
-// Calculates density altitude and related atmospheric parameters:
-// - Density altitude (how "high" the aircraft performs)
-// - Pressure altitude
-// - True vs Equivalent airspeed conversions
-// - Air density ratio (sigma)
-// - Performance degradation percentage
+// CLI entry point; the calculation core lives in density_altitude_calc.h
+// so the mfd_calcd daemon can reuse it without spawning this process.
 
+#include "batch_calc.h"
+#include "density_altitude_calc.h"
 #include "xplane_mfd_calc.h"
-#include <cmath>
 #include <cstdint>
 #include <cstring>
-#include <iomanip>
 #include <iostream>
 
-namespace airv
-{
-namespace calc
-{
-
-constexpr double sea_level_temp_c           = 15.0;
-constexpr double temp_lapse_rate            = 0.0019812;  // Celsius per foot (standard lapse rate)
-constexpr double kelvin_offset              = 273.15;
-constexpr double density_alt_factor         = 120.0;
-constexpr double pressure_altitude_constant = 6.8756e-6;
-constexpr double pressure_altitude_exponent = 5.2559;
-constexpr double min_ias_for_ratio          = 10.0;
-
-// Validation ranges: warning if input is not in range
-constexpr double min_altitude_ft   = -2000.0;
-constexpr double max_altitude_ft   = 60000.0;
-constexpr double min_temperature_c = -60.0;
-constexpr double max_temperature_c = 60.0;
-
-struct DensityAltitudeData
-{
-    double density_altitude_ft;      // Density altitude
-    double pressure_altitude_ft;     // Pressure altitude (from setting)
-    double air_density_ratio;        // ratio to sea level (sigma)
-    double temperature_deviation_c;  // Deviation from ISA
-    double performance_loss_pct;     // % performance loss vs sea level
-    double eas_kts;                  // Equivalent airspeed
-    double tas_to_ias_ratio;         // TAS/IAS ratio
-    double pressure_ratio;           // Pressure ratio vs sea level
-};
-
-// Calculate ISA temperature at given pressure altitude
-double isa_temperature_c(double pressure_altitude_ft)  // Pressure altitude (feet)
-{
-    return sea_level_temp_c - (temp_lapse_rate * pressure_altitude_ft);
-}
-
-// Calculate density altitude using exact formula
-// DA = PA + [120 * (OAT - ISA)]
-double calculate_density_altitude(double pressure_altitude_ft,  // Pressure altitude (feet)
-                                  double oat_celsius)           // Outside air temperature (Celsius)
-{
-    // ISA temperature at pressure altitude
-    double isa_temp = isa_temperature_c(pressure_altitude_ft);
-
-    // Temperature deviation from ISA
-    double temp_deviation = oat_celsius - isa_temp;
-
-    // Density altitude approximation (good to about 1% accuracy)
-    double density_altitude = pressure_altitude_ft + (density_alt_factor * temp_deviation);
-
-    return density_altitude;
-}
-
-// Calculate air density ratio (sigma)
-// sigma = rho / rho<sub>0</sub>
-double calculate_density_ratio(double pressure_altitude_ft,
-                               double oat_celsius)
-{
-    // Convert to absolute temperature
-    double temp_k           = oat_celsius + kelvin_offset;
-    double sea_level_temp_k = sea_level_temp_c + kelvin_offset;
-
-    // Pressure ratio (using standard atmosphere)
-    double pressure_ratio = pow(1.0 - pressure_altitude_constant * pressure_altitude_ft, pressure_altitude_exponent);
-
-    // Temperature ratio
-    double temp_ratio = sea_level_temp_k / temp_k;
-
-    // Density ratio: sigma = (P/P<sub>0</sub>) * (T<sub>0</sub>/T)
-    double sigma = pressure_ratio * temp_ratio;
-
-    return sigma;
-}
-
-// Calculate Equivalent Airspeed (EAS)
-// EAS = TAS * sqrt(sigma)
-double calculate_eas(double tas_kts,
-                     double sigma)
-{
-    return tas_kts * sqrt(sigma);
-}
-
-// Calculate complete density altitude data
-DensityAltitudeData calculate_density_altitude_data(double pressure_altitude_ft,  // Pressure altitude (feet)
-                                                    double oat_celsius,           // Outside air temperature (Celsius)
-                                                    double ias_kts,               // Indicated airspeed (knots)
-                                                    double tas_kts)               // True airspeed (knots)
-{
-    DensityAltitudeData result;
-
-    result.pressure_altitude_ft = pressure_altitude_ft;
-    result.density_altitude_ft  = calculate_density_altitude(pressure_altitude_ft, oat_celsius);
-
-    // ISA temperature at this altitude
-    double isa_temp                = isa_temperature_c(pressure_altitude_ft);
-    result.temperature_deviation_c = oat_celsius - isa_temp;
-
-    // Air density ratio
-    result.air_density_ratio = calculate_density_ratio(pressure_altitude_ft, oat_celsius);
-
-    // Performance loss (inverse of density ratio)
-    result.performance_loss_pct = (1.0 - result.air_density_ratio) * 100.0;
-
-    // Equivalent airspeed
-    result.eas_kts = calculate_eas(tas_kts, result.air_density_ratio);
-
-    result.tas_to_ias_ratio = ias_kts > min_ias_for_ratio ? tas_kts / ias_kts : 1.0;
-
-    // Pressure ratio
-    result.pressure_ratio = pow(1.0 - pressure_altitude_constant * pressure_altitude_ft, pressure_altitude_exponent);
-
-    return result;
-}
-
-// Output results as JSON
-void print_json(const DensityAltitudeData& da)
-{
-    std::cout << std::fixed << std::setprecision(2) << "{\n"
-              << "  \"density_altitude_ft\": " << da.density_altitude_ft << ",\n"
-              << "  \"pressure_altitude_ft\": " << da.pressure_altitude_ft << ",\n"
-              << "  \"air_density_ratio\": " << da.air_density_ratio << ",\n"
-              << "  \"temperature_deviation_c\": " << da.temperature_deviation_c << ",\n"
-              << "  \"performance_loss_pct\": " << da.performance_loss_pct << ",\n"
-              << "  \"eas_kts\": " << da.eas_kts << ",\n"
-              << "  \"tas_to_ias_ratio\": " << da.tas_to_ias_ratio << ",\n"
-              << "  \"pressure_ratio\": " << da.pressure_ratio << "\n"
-              << "}\n";
-}
-
-}  // namespace calc
-}  // namespace airv
-
 void print_usage(const char* program_name)
 {
-    std::cerr << "Usage: " << program_name << " <pressure_alt_ft> <oat_celsius> <ias_kts> <tas_kts> [force_error]\n"
+    std::cerr << "Usage: " << program_name << " [--exact] <pressure_alt_ft> <oat_celsius> <ias_kts> <tas_kts> [force_error]\n"
               << "\n"
               << "Arguments:\n"
               << "  pressure_alt_ft : Pressure altitude (feet)\n"
@@ -158,15 +21,45 @@ void print_usage(const char* program_name)
               << "  ias_kts        : Indicated airspeed (knots)\n"
               << "  tas_kts        : True airspeed (knots)\n"
               << "  force_error    : Optional, 1 to simulate error (default: 0)\n"
+              << "  --exact        : Use the closed-form ISA formulas instead of the lookup table\n"
               << "\n"
               << "Example:\n"
               << "  " << program_name << " 5000 25 150 170\n"
-              << "  (5000 ft PA, 25 Celsius OAT, 150 kts IAS, 170 kts TAS)\n";
+              << "  (5000 ft PA, 25 Celsius OAT, 150 kts IAS, 170 kts TAS)\n"
+              << "Batch mode (raw DensitySample records in, DensityAltitudeData records out):\n"
+              << "  " << program_name << " --batch input.bin output.bin\n";
 }
 
 int main(int argc,
          char* argv[])
 {
+    // Replay mode: process a whole file of recorded samples in one process
+    if (argc == 4 && strcmp(argv[1], "--batch") == 0)
+    {
+        int64_t processed =
+            airv::batch::run_batch_file<airv::batch::DensitySample, airv::calc::DensityAltitudeData>(
+                argv[2], argv[3], airv::batch::calculate_density_altitude_batch);
+        if (processed < 0)
+        {
+            std::cerr << "Error: Batch I/O failed\n";
+            return static_cast<int>(airv::Return_code::invalid_value);
+        }
+        std::cerr << "Processed " << processed << " samples\n";
+        return static_cast<int>(airv::Return_code::success);
+    }
+
+    // Verification mode: bypass the ISA lookup table
+    bool exact_formulas = false;
+    if (argc >= 2 && strcmp(argv[1], "--exact") == 0)
+    {
+        exact_formulas = true;
+        for (int32_t i = 1; i < argc - 1; ++i)
+        {
+            argv[i] = argv[i + 1];
+        }
+        --argc;
+    }
+
     if (argc < 5 || 6 < argc)
     {
         print_usage(argv[0]);
@@ -224,8 +117,8 @@ int main(int argc,
     }
 
     // Calculate and output results
-    airv::calc::print_json(
-        airv::calc::calculate_density_altitude_data(pressure_altitude_ft, oat_celsius, ias_kts, tas_kts));
+    airv::calc::print_json(airv::calc::calculate_density_altitude_data(
+        pressure_altitude_ft, oat_celsius, ias_kts, tas_kts, exact_formulas));
 
     return static_cast<int>(airv::Return_code::success);
-}
\ No newline at end of file
+}
@@ -0,0 +1,102 @@
+// Per-calculator dirty tracking for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// In cruise most inputs barely move between simulator frames — altitude and
+// heading can be static for minutes — yet the push-feed loop would run all
+// calculation cores on every tick.  The tracker holds the last accepted
+// value and an epsilon per input field; an incoming value inside its epsilon
+// leaves the field clean, one outside marks the field's bit in a dirty mask.
+// Each calculator declares the mask of fields it reads, asks is_dirty before
+// recomputing, and otherwise serves its cached result.  A calculator whose
+// inputs derive from another's output (glide reads the wind headwind) simply
+// includes the producer's mask in its own.
+//
+// All fields start dirty so the first frame always computes everything.
+
+#ifndef DIRTY_TRACKER
+#define DIRTY_TRACKER
+
+#include <cmath>
+#include <cstdint>
+
+namespace airv
+{
+namespace sched
+{
+
+// One tracked field per bit of the dirty mask
+constexpr int32_t max_fields = 32;
+
+constexpr uint32_t field_bit(int32_t field)
+{
+    return 1U << field;
+}
+
+class DirtyTracker
+{
+public:
+    DirtyTracker()
+        : field_count_(0),
+          dirty_mask_(0xFFFFFFFFU)
+    {
+        for (int32_t i = 0; i < max_fields; ++i)
+        {
+            values_[i]   = 0.0;
+            epsilons_[i] = 0.0;
+        }
+    }
+
+    // Register one field; returns its index (the bit position), or -1 full
+    int32_t add_field(double epsilon)
+    {
+        int32_t result = -1;
+
+        if (field_count_ < max_fields)
+        {
+            epsilons_[field_count_] = epsilon;
+            result                  = field_count_;
+            ++field_count_;
+        }
+
+        return result;
+    }
+
+    // Accept an incoming value; the field goes dirty only when it moved
+    // further than its epsilon from the last accepted value
+    void set_input(int32_t field,
+                   double value)
+    {
+        if (field >= 0 && field < field_count_)
+        {
+            if (fabs(value - values_[field]) > epsilons_[field])
+            {
+                values_[field] = value;
+                dirty_mask_ |= field_bit(field);
+            }
+        }
+    }
+
+    // True when any field of the calculator's dependency mask moved
+    bool is_dirty(uint32_t dependency_mask) const { return (dirty_mask_ & dependency_mask) != 0U; }
+
+    // Last accepted value; calculators read inputs here so that every
+    // consumer of a clean field sees exactly the value it was computed from
+    double value(int32_t field) const
+    {
+        return (field >= 0 && field < field_count_) ? values_[field] : 0.0;
+    }
+
+    // Call once per frame after every calculator ran or was skipped
+    void mark_clean() { dirty_mask_ = 0U; }
+
+private:
+    double values_[max_fields];    // Last accepted value per field
+    double epsilons_[max_fields];  // Dead band per field
+    int32_t field_count_;
+    uint32_t dirty_mask_;
+};
+
+}  // namespace sched
+}  // namespace airv
+
+#endif  // !DIRTY_TRACKER
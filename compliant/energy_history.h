@@ -0,0 +1,238 @@
+// Multi-resolution energy history for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// calculate_energy reduces the energy state to a three-way trend enum
+// against a 50 fpm threshold, which is too coarse for an energy tape
+// that shows the last ten seconds finely and the last ten minutes in
+// outline.  This store keeps the specific-energy height in tiered
+// fixed-size rings, RRD-style: tier 0 takes every flight frame (nominal
+// 1 Hz, 60 s of history), tier 1 takes the mean of every ten tier-0
+// samples (nominal 0.1 Hz, 10 min).  The cascade is O(1) amortized --
+// one add per frame plus one push per ten frames.
+//
+// Every published aggregate is maintained incrementally as samples
+// arrive, so a query copies ready numbers instead of rescanning:
+//   mean   running sum over the window
+//   slope  least-squares regression over the window, via running value
+//          and index-weighted sums updated in O(1) per sample
+//   min    monotonic deques holding candidate extrema; each sample
+//   max    enters and leaves each deque at most once, O(1) amortized
+
+#ifndef ENERGY_HISTORY
+#define ENERGY_HISTORY
+
+#include "flight_calc.h"
+#include <cstdint>
+
+namespace airv
+{
+namespace calc
+{
+
+// Tier geometry: 60 samples per ring, ten tier-0 samples fold into one
+// tier-1 sample
+constexpr int32_t energy_tier_count      = 2;
+constexpr int32_t energy_ring_samples    = 60;
+constexpr int32_t energy_cascade_factor  = 10;
+
+// Nominal seconds between samples at each tier, for slope scaling
+constexpr double energy_tier_period_s[energy_tier_count] = { 1.0, 10.0 };
+
+// Ready-made aggregates for one tier, valid once two samples exist
+struct EnergyTierStats
+{
+    double min_ft;          // Lowest specific energy in the window
+    double max_ft;          // Highest specific energy in the window
+    double mean_ft;         // Window mean
+    double slope_ft_per_s;  // Regression slope at the tier's nominal rate
+    int32_t count;          // Samples currently in the window
+    bool valid;             // False until the window holds two samples
+};
+
+// One fixed-rate ring with incrementally maintained aggregates
+class EnergyRing
+{
+public:
+    EnergyRing()
+        : next_index_(0),
+          sum_(0.0),
+          weighted_sum_(0.0),
+          min_head_(0),
+          min_count_(0),
+          max_head_(0),
+          max_count_(0)
+    {
+        for (int32_t i = 0; i < energy_ring_samples; ++i)
+        {
+            values_[i]      = 0.0;
+            min_indices_[i] = 0;
+            max_indices_[i] = 0;
+        }
+    }
+
+    // Append one sample, retiring the oldest once the ring is full
+    void push(double value)
+    {
+        int32_t count = window_count();
+
+        if (count == energy_ring_samples)
+        {
+            // Retire the oldest sample: drop it from the sums, then
+            // shift every remaining regression weight down by one
+            double oldest = values_[next_index_ % energy_ring_samples];
+
+            sum_ -= oldest;
+            weighted_sum_ -= sum_;
+            count -= 1;
+        }
+
+        // Expired extremum candidates fall off the deque fronts
+        while (min_count_ > 0 && min_indices_[min_head_] + energy_ring_samples <= next_index_)
+        {
+            min_head_ = (min_head_ + 1) % energy_ring_samples;
+            --min_count_;
+        }
+        while (max_count_ > 0 && max_indices_[max_head_] + energy_ring_samples <= next_index_)
+        {
+            max_head_ = (max_head_ + 1) % energy_ring_samples;
+            --max_count_;
+        }
+
+        // Dominated candidates fall off the backs before the new sample
+        // enters; each sample joins and leaves at most once
+        while (min_count_ > 0 && value_at(min_indices_[(min_head_ + min_count_ - 1) % energy_ring_samples]) >= value)
+        {
+            --min_count_;
+        }
+        while (max_count_ > 0 && value_at(max_indices_[(max_head_ + max_count_ - 1) % energy_ring_samples]) <= value)
+        {
+            --max_count_;
+        }
+
+        values_[next_index_ % energy_ring_samples] = value;
+
+        min_indices_[(min_head_ + min_count_) % energy_ring_samples] = next_index_;
+        ++min_count_;
+        max_indices_[(max_head_ + max_count_) % energy_ring_samples] = next_index_;
+        ++max_count_;
+
+        // New sample carries the highest regression weight in the window
+        weighted_sum_ += static_cast<double>(count) * value;
+        sum_ += value;
+        ++next_index_;
+    }
+
+    // Copy out the aggregates; period_s scales the per-sample slope
+    EnergyTierStats stats(double period_s) const
+    {
+        EnergyTierStats result;
+        int32_t count = window_count();
+
+        result.count          = count;
+        result.valid          = (count >= 2);
+        result.min_ft         = 0.0;
+        result.max_ft         = 0.0;
+        result.mean_ft        = 0.0;
+        result.slope_ft_per_s = 0.0;
+
+        if (count > 0)
+        {
+            result.min_ft  = value_at(min_indices_[min_head_]);
+            result.max_ft  = value_at(max_indices_[max_head_]);
+            result.mean_ft = sum_ / static_cast<double>(count);
+        }
+        if (result.valid)
+        {
+            // Least squares with evenly spaced abscissae 0..count-1:
+            // slope = (W - mean_index * S) / sum((i - mean_index)^2)
+            double n          = static_cast<double>(count);
+            double mean_index = 0.5 * (n - 1.0);
+            double spread     = n * ((n * n) - 1.0) / 12.0;
+
+            result.slope_ft_per_s = ((weighted_sum_ - (mean_index * sum_)) / spread) / period_s;
+        }
+
+        return result;
+    }
+
+private:
+    int32_t window_count() const
+    {
+        return (next_index_ < energy_ring_samples) ? next_index_ : energy_ring_samples;
+    }
+
+    double value_at(int32_t absolute_index) const
+    {
+        return values_[absolute_index % energy_ring_samples];
+    }
+
+    double values_[energy_ring_samples];        // Sample ring, slot = index mod capacity
+    int32_t next_index_;                        // Absolute count of samples ever pushed
+    double sum_;                                // Running sum over the window
+    double weighted_sum_;                       // Running sum of window_position * value
+    int32_t min_indices_[energy_ring_samples];  // Ascending-value candidate deque
+    int32_t min_head_;
+    int32_t min_count_;
+    int32_t max_indices_[energy_ring_samples];  // Descending-value candidate deque
+    int32_t max_head_;
+    int32_t max_count_;
+};
+
+// The tier stack mfd_calcd feeds from every flight frame
+class EnergyHistory
+{
+public:
+    EnergyHistory()
+        : cascade_sum_(0.0),
+          cascade_count_(0)
+    {
+    }
+
+    // Record one EnergyData result; every tenth call folds the batch
+    // mean into the coarse tier
+    void record(const EnergyData& energy)
+    {
+        tiers_[0].push(energy.specific_energy_ft);
+
+        cascade_sum_ += energy.specific_energy_ft;
+        ++cascade_count_;
+
+        if (cascade_count_ == energy_cascade_factor)
+        {
+            tiers_[1].push(cascade_sum_ / static_cast<double>(energy_cascade_factor));
+            cascade_sum_   = 0.0;
+            cascade_count_ = 0;
+        }
+    }
+
+    EnergyTierStats stats(int32_t tier) const
+    {
+        EnergyTierStats result;
+
+        if (tier >= 0 && tier < energy_tier_count)
+        {
+            result = tiers_[tier].stats(energy_tier_period_s[tier]);
+        }
+        else
+        {
+            result.min_ft          = 0.0;
+            result.max_ft          = 0.0;
+            result.mean_ft         = 0.0;
+            result.slope_ft_per_s  = 0.0;
+            result.count           = 0;
+            result.valid           = false;
+        }
+
+        return result;
+    }
+
+private:
+    EnergyRing tiers_[energy_tier_count];
+    double cascade_sum_;    // Pending tier-1 batch
+    int32_t cascade_count_; // Samples in the pending batch
+};
+
+}  // namespace calc
+}  // namespace airv
+
+#endif  // ENERGY_HISTORY
@@ -0,0 +1,438 @@
+// Event-driven multi-client socket server for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// One epoll instance watches the listen socket and every client; the
+// loop never blocks on any single fd.  Output interest is armed only
+// while a client's ring holds bytes, so an idle steady state costs one
+// epoll_wait per frame batch.
+
+#include "event_server.h"
+
+#include <cerrno>
+#include <cstring>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace airv
+{
+namespace net
+{
+
+namespace
+{
+
+// epoll user-data token marking the listen socket; client tokens are slots
+constexpr uint32_t listen_token = 0xFFFFFFFFU;
+
+}  // namespace
+
+EventServer::EventServer()
+    : listen_fd_(-1),
+      epoll_fd_(-1),
+      current_client_(-1),
+      scan_cursor_(0)
+{
+    for (int32_t i = 0; i < max_clients; ++i)
+    {
+        clients_[i].fd        = -1;
+        clients_[i].in_length = 0;
+        clients_[i].out_head  = 0;
+        clients_[i].out_count = 0;
+        clients_[i].out_armed = false;
+        clients_[i].dropped   = 0;
+    }
+}
+
+bool EventServer::open(const char* path)
+{
+    bool ok = !is_open() && path != nullptr && strlen(path) < sizeof(sockaddr_un::sun_path);
+
+    if (ok)
+    {
+        listen_fd_ = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0);
+        ok         = (listen_fd_ >= 0);
+    }
+    if (ok)
+    {
+        struct sockaddr_un address;
+        memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        strncpy(address.sun_path, path, sizeof(address.sun_path) - 1U);
+
+        // Remove any stale socket file from a previous run
+        unlink(path);
+
+        ok = (bind(listen_fd_, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)) == 0) &&
+             (listen(listen_fd_, listen_backlog) == 0);
+    }
+    if (ok)
+    {
+        epoll_fd_ = epoll_create1(0);
+        ok        = (epoll_fd_ >= 0);
+    }
+    if (ok)
+    {
+        struct epoll_event event;
+        memset(&event, 0, sizeof(event));
+        event.events   = EPOLLIN;
+        event.data.u32 = listen_token;
+
+        ok = (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, listen_fd_, &event) == 0);
+    }
+    if (!ok)
+    {
+        close();
+    }
+
+    return ok;
+}
+
+void EventServer::close()
+{
+    for (int32_t i = 0; i < max_clients; ++i)
+    {
+        if (clients_[i].fd >= 0)
+        {
+            drop_client(i);
+        }
+    }
+    if (epoll_fd_ >= 0)
+    {
+        ::close(epoll_fd_);
+        epoll_fd_ = -1;
+    }
+    if (listen_fd_ >= 0)
+    {
+        ::close(listen_fd_);
+        listen_fd_ = -1;
+    }
+}
+
+bool EventServer::poll(int32_t timeout_ms)
+{
+    struct epoll_event events[max_poll_events];
+    int ready = epoll_wait(epoll_fd_, events, max_poll_events, timeout_ms);
+    bool ok   = (ready >= 0) || (errno == EINTR);
+
+    for (int i = 0; ok && i < ready; ++i)
+    {
+        if (events[i].data.u32 == listen_token)
+        {
+            accept_clients();
+        }
+        else
+        {
+            int32_t slot = static_cast<int32_t>(events[i].data.u32);
+
+            if ((events[i].events & (EPOLLHUP | EPOLLERR)) != 0U)
+            {
+                drop_client(slot);
+            }
+            else
+            {
+                if ((events[i].events & EPOLLIN) != 0U)
+                {
+                    read_client(slot);
+                }
+                if (clients_[slot].fd >= 0 && (events[i].events & EPOLLOUT) != 0U)
+                {
+                    flush_client(slot);
+                }
+            }
+        }
+    }
+
+    return ok;
+}
+
+bool EventServer::next_line(char* line,
+                            int32_t capacity)
+{
+    bool found = false;
+
+    // Round robin: resume the scan one past the previous source
+    for (int32_t step = 0; !found && step < max_clients; ++step)
+    {
+        int32_t slot = (scan_cursor_ + step) % max_clients;
+
+        if (clients_[slot].fd >= 0 && pop_line(slot, line, capacity))
+        {
+            current_client_ = slot;
+            scan_cursor_    = (slot + 1) % max_clients;
+            found           = true;
+        }
+    }
+
+    return found;
+}
+
+bool EventServer::continuation_line(char* line,
+                                    int32_t capacity)
+{
+    return current_client_ >= 0 && clients_[current_client_].fd >= 0 &&
+           pop_line(current_client_, line, capacity);
+}
+
+void EventServer::broadcast(const char* data,
+                            size_t length)
+{
+    for (int32_t i = 0; i < max_clients; ++i)
+    {
+        Client& client = clients_[i];
+
+        if (client.fd >= 0)
+        {
+            if (length > client_queue_bytes - client.out_count)
+            {
+                // Backpressure: drop the whole frame for this client only
+                ++client.dropped;
+            }
+            else
+            {
+                size_t tail  = (client.out_head + client.out_count) % client_queue_bytes;
+                size_t first = client_queue_bytes - tail;
+
+                if (first > length)
+                {
+                    first = length;
+                }
+                memcpy(&client.out_queue[tail], data, first);
+                memcpy(&client.out_queue[0], &data[first], length - first);
+                client.out_count += length;
+
+                flush_client(i);
+            }
+        }
+    }
+}
+
+int32_t EventServer::client_count() const
+{
+    int32_t count = 0;
+
+    for (int32_t i = 0; i < max_clients; ++i)
+    {
+        if (clients_[i].fd >= 0)
+        {
+            ++count;
+        }
+    }
+
+    return count;
+}
+
+uint64_t EventServer::dropped_frames() const
+{
+    uint64_t total = 0;
+
+    for (int32_t i = 0; i < max_clients; ++i)
+    {
+        total += clients_[i].dropped;
+    }
+
+    return total;
+}
+
+void EventServer::accept_clients()
+{
+    bool more = true;
+
+    while (more)
+    {
+        int fd = accept4(listen_fd_, nullptr, nullptr, SOCK_NONBLOCK);
+
+        if (fd < 0)
+        {
+            more = false;
+        }
+        else
+        {
+            int32_t slot = -1;
+
+            for (int32_t i = 0; slot < 0 && i < max_clients; ++i)
+            {
+                if (clients_[i].fd < 0)
+                {
+                    slot = i;
+                }
+            }
+            if (slot < 0)
+            {
+                // Every slot taken; refuse quietly
+                ::close(fd);
+            }
+            else
+            {
+                struct epoll_event event;
+                memset(&event, 0, sizeof(event));
+                event.events   = EPOLLIN;
+                event.data.u32 = static_cast<uint32_t>(slot);
+
+                if (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, fd, &event) != 0)
+                {
+                    ::close(fd);
+                }
+                else
+                {
+                    clients_[slot].fd        = fd;
+                    clients_[slot].in_length = 0;
+                    clients_[slot].out_head  = 0;
+                    clients_[slot].out_count = 0;
+                    clients_[slot].out_armed = false;
+                    clients_[slot].dropped   = 0;
+                }
+            }
+        }
+    }
+}
+
+void EventServer::read_client(int32_t slot)
+{
+    Client& client = clients_[slot];
+    bool more      = true;
+
+    while (more && client.fd >= 0)
+    {
+        size_t room = client_in_bytes - client.in_length;
+
+        if (room == 0)
+        {
+            // A line longer than the whole buffer is a protocol violation
+            drop_client(slot);
+        }
+        else
+        {
+            ssize_t got = read(client.fd, &client.in_buffer[client.in_length], room);
+
+            if (got > 0)
+            {
+                client.in_length += static_cast<size_t>(got);
+            }
+            else if (got == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR))
+            {
+                drop_client(slot);
+            }
+            else
+            {
+                more = false;
+            }
+        }
+    }
+}
+
+void EventServer::drop_client(int32_t slot)
+{
+    Client& client = clients_[slot];
+
+    if (client.fd >= 0)
+    {
+        epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, client.fd, nullptr);
+        ::close(client.fd);
+        client.fd        = -1;
+        client.in_length = 0;
+        client.out_head  = 0;
+        client.out_count = 0;
+        client.out_armed = false;
+    }
+    if (current_client_ == slot)
+    {
+        current_client_ = -1;
+    }
+}
+
+void EventServer::flush_client(int32_t slot)
+{
+    Client& client = clients_[slot];
+    bool more      = true;
+
+    while (more && client.fd >= 0 && client.out_count > 0)
+    {
+        size_t contiguous = client_queue_bytes - client.out_head;
+
+        if (contiguous > client.out_count)
+        {
+            contiguous = client.out_count;
+        }
+
+        ssize_t sent = write(client.fd, &client.out_queue[client.out_head], contiguous);
+
+        if (sent > 0)
+        {
+            client.out_head = (client.out_head + static_cast<size_t>(sent)) % client_queue_bytes;
+            client.out_count -= static_cast<size_t>(sent);
+        }
+        else if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+        {
+            more = false;
+        }
+        else
+        {
+            drop_client(slot);
+        }
+    }
+
+    if (client.fd >= 0)
+    {
+        update_events(slot);
+    }
+}
+
+void EventServer::update_events(int32_t slot)
+{
+    Client& client  = clients_[slot];
+    bool want_out   = (client.out_count > 0);
+
+    if (want_out != client.out_armed)
+    {
+        struct epoll_event event;
+        memset(&event, 0, sizeof(event));
+        event.events   = want_out ? (EPOLLIN | EPOLLOUT) : EPOLLIN;
+        event.data.u32 = static_cast<uint32_t>(slot);
+
+        if (epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, client.fd, &event) == 0)
+        {
+            client.out_armed = want_out;
+        }
+    }
+}
+
+bool EventServer::pop_line(int32_t slot,
+                           char* line,
+                           int32_t capacity)
+{
+    Client& client = clients_[slot];
+    bool found     = false;
+    size_t end     = 0;
+
+    for (size_t i = 0; !found && i < client.in_length; ++i)
+    {
+        if (client.in_buffer[i] == '\n')
+        {
+            end   = i;
+            found = true;
+        }
+    }
+
+    if (found)
+    {
+        size_t copy = end;
+
+        if (copy >= static_cast<size_t>(capacity))
+        {
+            copy = static_cast<size_t>(capacity) - 1U;
+        }
+        memcpy(line, client.in_buffer, copy);
+        line[copy] = '\0';
+
+        // Consume the line and its terminator
+        memmove(client.in_buffer, &client.in_buffer[end + 1U], client.in_length - end - 1U);
+        client.in_length -= end + 1U;
+    }
+
+    return found;
+}
+
+}  // namespace net
+}  // namespace airv
@@ -0,0 +1,124 @@
+// Event-driven multi-client socket server for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// Three display heads (pilot, copilot, engineering station) off one sim
+// used to mean three copies of the whole calculation pipeline.  This
+// server lets one daemon accept them all on a Unix stream socket with a
+// single-threaded epoll loop: requests arrive as newline-framed lines,
+// every computed reply fans out to every connected client, and all
+// socket I/O is non-blocking.  Each client owns a fixed-size output ring;
+// a stalled head whose ring cannot take a whole reply drops that frame
+// (counted, never partial) instead of blocking the loop, so a slow
+// client costs the others nothing.
+//
+// All client storage is preallocated at the connection cap — no heap
+// traffic after open(), in line with the compliant build rules.
+
+#ifndef EVENT_SERVER
+#define EVENT_SERVER
+
+#include <cstddef>
+#include <cstdint>
+
+namespace airv
+{
+namespace net
+{
+
+// Connection cap; three heads today, headroom for test harnesses
+constexpr int32_t max_clients = 8;
+
+// Per-client output ring; the backpressure limit.  Holds several of the
+// largest (traffic) replies before frames start dropping.
+constexpr size_t client_queue_bytes = 256U * 1024U;
+
+// Per-client input buffer; a whole multi-line traffic frame fits
+constexpr size_t client_in_bytes = 8U * 1024U;
+
+constexpr int32_t listen_backlog = 4;
+
+// epoll_wait batch size per poll() call
+constexpr int32_t max_poll_events = 16;
+
+class EventServer
+{
+public:
+    EventServer();
+
+    ~EventServer() { close(); }
+
+    // Create, bind, and listen on a Unix stream socket at path (any
+    // stale socket file is removed), and set up the epoll instance
+    bool open(const char* path);
+
+    void close();
+
+    bool is_open() const { return listen_fd_ >= 0; }
+
+    // Wait for socket readiness and service it: accept new clients, pull
+    // bytes into input buffers, flush pending output rings.  Returns
+    // false only on an unrecoverable epoll failure.
+    bool poll(int32_t timeout_ms);
+
+    // Pop the next complete request line buffered from any client, round
+    // robin so one chatty head cannot starve the others.  The source
+    // client stays current for continuation_line until the next call.
+    bool next_line(char* line,
+                   int32_t capacity);
+
+    // Pop a continuation line (multi-line requests such as traffic) from
+    // the client whose request line next_line last returned
+    bool continuation_line(char* line,
+                           int32_t capacity);
+
+    // Queue one reply to every connected client.  A client without room
+    // for the whole reply drops it and counts the drop; frames are never
+    // split across clients.
+    void broadcast(const char* data,
+                   size_t length);
+
+    int32_t client_count() const;
+
+    // Total reply frames dropped to backpressure across all clients
+    uint64_t dropped_frames() const;
+
+private:
+    struct Client
+    {
+        int fd;             // -1 when the slot is free
+        size_t in_length;   // Bytes buffered awaiting a newline
+        size_t out_head;    // Ring read position
+        size_t out_count;   // Bytes queued in the ring
+        bool out_armed;     // EPOLLOUT currently requested
+        uint64_t dropped;   // Reply frames dropped to backpressure
+        char in_buffer[client_in_bytes];
+        char out_queue[client_queue_bytes];
+    };
+
+    void accept_clients();
+
+    void read_client(int32_t slot);
+
+    void drop_client(int32_t slot);
+
+    // Non-blocking write from the ring; rearms EPOLLOUT while bytes remain
+    void flush_client(int32_t slot);
+
+    void update_events(int32_t slot);
+
+    // Extract one newline-terminated line from a client's input buffer
+    bool pop_line(int32_t slot,
+                  char* line,
+                  int32_t capacity);
+
+    int listen_fd_;
+    int epoll_fd_;
+    int32_t current_client_;  // Source of the last next_line result
+    int32_t scan_cursor_;     // Round-robin position for next_line
+    Client clients_[max_clients];
+};
+
+}  // namespace net
+}  // namespace airv
+
+#endif  // !EVENT_SERVER
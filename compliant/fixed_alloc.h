@@ -0,0 +1,141 @@
+// Fixed-capacity allocation primitives for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// The compliant build bans heap traffic, which until now meant every
+// feature carried its own ad-hoc static arrays.  This header provides the
+// shared machinery: a statically backed bump arena for per-request scratch
+// that resets whole in O(1) between frames, and a typed fixed-capacity
+// pool with LIFO free-list reuse for objects that outlive a single
+// request.  Exhaustion returns nullptr — never throws, never touches the
+// heap — so worst-case timing is a handful of integer operations.
+//
+// Arena storage is raw bytes: no constructors run, so it suits the
+// trivially-constructible result and scratch structs this tree is built
+// from.  Pool items are real T objects constructed once with the pool.
+
+#ifndef FIXED_ALLOC
+#define FIXED_ALLOC
+
+#include <cstddef>
+#include <cstdint>
+
+namespace airv
+{
+namespace utils
+{
+
+// Default allocation alignment; holds for every scalar type in the tree
+constexpr size_t arena_alignment = alignof(double);
+
+// Bump arena over a statically sized buffer.  allocate() advances a
+// cursor; reset() rewinds it.  Nothing is freed individually.
+template <size_t Capacity>
+class Arena
+{
+public:
+    Arena()
+        : used_(0)
+    {
+    }
+
+    // Raw allocation; nullptr once the arena cannot hold the request
+    void* allocate(size_t bytes,
+                   size_t alignment = arena_alignment)
+    {
+        void* result   = nullptr;
+        size_t aligned = (used_ + (alignment - 1U)) & ~(alignment - 1U);
+
+        if (bytes <= Capacity && aligned <= Capacity - bytes)
+        {
+            result = &storage_[aligned];
+            used_  = aligned + bytes;
+        }
+
+        return result;
+    }
+
+    // Typed array of count elements; memory is raw, caller initializes
+    template <typename T>
+    T* allocate_array(size_t count)
+    {
+        return static_cast<T*>(allocate(count * sizeof(T), alignof(T)));
+    }
+
+    // Single typed object; memory is raw, caller initializes
+    template <typename T>
+    T* allocate_object()
+    {
+        return allocate_array<T>(1U);
+    }
+
+    // Whole-arena reset; O(1), called once per frame
+    void reset() { used_ = 0; }
+
+    size_t used() const { return used_; }
+
+    size_t capacity() const { return Capacity; }
+
+private:
+    alignas(16) unsigned char storage_[Capacity];
+    size_t used_;
+};
+
+// Typed fixed-capacity pool.  acquire() pops the most recently released
+// slot (warm in cache); release() pushes it back.  Both are O(1).
+template <typename T, int32_t Capacity>
+class Pool
+{
+public:
+    Pool()
+        : free_count_(Capacity)
+    {
+        for (int32_t i = 0; i < Capacity; ++i)
+        {
+            free_stack_[i] = i;
+        }
+    }
+
+    // Claim one item; nullptr when every slot is in use
+    T* acquire()
+    {
+        T* result = nullptr;
+
+        if (free_count_ > 0)
+        {
+            --free_count_;
+            result = &items_[free_stack_[free_count_]];
+        }
+
+        return result;
+    }
+
+    // Return an item to the free list; pointers outside the pool are
+    // ignored rather than corrupting the stack
+    void release(T* item)
+    {
+        if (item != nullptr && free_count_ < Capacity)
+        {
+            int32_t index = static_cast<int32_t>(item - &items_[0]);
+
+            if (index >= 0 && index < Capacity)
+            {
+                free_stack_[free_count_] = index;
+                ++free_count_;
+            }
+        }
+    }
+
+    int32_t available() const { return free_count_; }
+
+    int32_t capacity() const { return Capacity; }
+
+private:
+    T items_[Capacity];
+    int32_t free_stack_[Capacity];  // Indices of free slots, top at free_count_ - 1
+    int32_t free_count_;
+};
+
+}  // namespace utils
+}  // namespace airv
+
+#endif  // !FIXED_ALLOC
@@ -0,0 +1,383 @@
+// Flight performance calculation core for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// Shared between the flight_calculator CLI and the mfd_calcd daemon.
+// Performs advanced flight calculations:
+// - Real-time wind vector with gust/turbulence analysis
+// - Envelope margins (stall/overspeed/buffet)
+// - Energy management (specific energy & trend)
+// - Glide reach estimation
+
+#ifndef FLIGHT_CALC
+#define FLIGHT_CALC
+
+#include "json_writer.h"
+#include "wind_calc.h"
+#include "xplane_mfd_calc.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+
+namespace airv
+{
+namespace calc
+{
+
+// Fixed-size array limit
+constexpr int32_t max_ias_history = 20;
+
+// Calculation constants
+constexpr double sqrt_two               = 1.414;  //! Not accurate
+constexpr double typical_glide_ratio    = 12.0;
+constexpr double best_glide_multiplier  = 1.3;
+constexpr double typical_vs             = 60.0;
+constexpr double energy_rate_divisor    = 101.27;
+constexpr double energy_trend_threshold = 50.0;
+constexpr double min_history_for_stats  = 2.0;
+
+enum class Trend
+{
+    decreasing = -1,
+    stable     = 0,
+    increasing = 1,
+};
+
+struct Vector2D
+{
+    double x, y;
+
+    Vector2D(double x_ = 0.0,
+             double y_ = 0.0)
+        : x(x_),
+          y(y_)
+    {
+    }
+
+    double magnitude() const { return sqrt(x * x + y * y); }
+
+    Vector2D operator-(const Vector2D& other) const { return Vector2D(x - other.x, y - other.y); }
+};
+
+// Uses iterative formula to avoid overflow: C(n,k) = product(i=1 to k) (n-k+i)/i
+inline uint64_t binomial_coefficient(uint32_t n,
+                                     uint32_t k)
+{
+    uint64_t result = 0;
+
+    if (k > n)
+    {
+        result = 0;
+    }
+    else if (k == 0 || k == n)
+    {
+        result = 1;
+    }
+    else if (k == 1)
+    {
+        result = n;
+    }
+    else
+    {
+        // Optimize: C(n,k) = C(n, n-k), use smaller k
+        if (k > n - k)
+        {
+            k = n - k;
+        }
+
+        // Iterative calculation to avoid overflow
+        result = 1;
+        for (uint32_t i = 1; i <= k; ++i)
+        {
+            result = result * (n - k + i) / i;
+        }
+    }
+
+    return result;  // Single exit point
+}
+
+struct WindData
+{
+    double speed_kts;
+    double direction_from;  // deg, where wind comes FROM
+    double headwind;
+    double crosswind;
+    double gust_factor;
+};
+
+inline WindData calculate_wind_vector(double tas_kts,
+                                      double gs_kts,
+                                      double heading_deg,
+                                      double track_deg,
+                                      double gust_factor)  // Precomputed, see SensorHistoryBuffer::gust_factor()
+{
+    WindData result;
+
+    // Convert to vectors
+    double heading_rad = heading_deg * units::deg_to_rad;
+    double track_rad   = track_deg * units::deg_to_rad;
+
+    // Air vector (TAS in heading direction)
+    Vector2D air_vec(tas_kts * sin(heading_rad), tas_kts * cos(heading_rad));
+
+    // Ground vector (GS in track direction)
+    Vector2D ground_vec(gs_kts * sin(track_rad), gs_kts * cos(track_rad));
+
+    // Wind = Ground - Air
+    Vector2D wind_vec = ground_vec - air_vec;
+
+    result.speed_kts = wind_vec.magnitude();
+
+    // Wind direction (where FROM)
+    double wind_dir_rad   = atan2(wind_vec.x, wind_vec.y);
+    result.direction_from = units::Angle::from_radians(wind_dir_rad).degrees();
+
+    // Components relative to track (shared decomposition, see wind_calc.h)
+    wind_components_on_track(result.direction_from, result.speed_kts, track_deg, result.headwind, result.crosswind);
+
+    // Gust factor is maintained incrementally by the history buffer
+    result.gust_factor = gust_factor;
+
+    return result;
+}
+
+struct EnvelopeMargins
+{
+    double stall_margin_pct;
+    double vmo_margin_pct;
+    double mmo_margin_pct;
+    double min_margin_pct;
+    double load_factor;
+    double corner_speed_kts;
+};
+
+inline EnvelopeMargins calculate_envelope(double bank_deg,  // Bank angle (deg)
+                                          double ias_kts,   // Indicated airspeed (knots)
+                                          double mach,      // Mach number
+                                          double vso_kts,   // Stall speed in landing config (knots IAS)
+                                          double vne_kts,   // Velocity never exceed (knots IAS)
+                                          double mmo)       // Maximum operating Mach number
+{
+    EnvelopeMargins result;
+
+    // Load factor
+    double bank_rad    = bank_deg * units::deg_to_rad;
+    result.load_factor = 1.0 / cos(bank_rad);
+
+    // Stall speed increases with load factor
+    double vs_actual        = vso_kts * sqrt(result.load_factor);
+    result.stall_margin_pct = ((ias_kts - vs_actual) / vs_actual) * 100.0;
+
+    // VMO margin
+    result.vmo_margin_pct = ((vne_kts - ias_kts) / vne_kts) * 100.0;
+
+    // MMO margin
+    result.mmo_margin_pct = ((mmo - mach) / mmo) * 100.0;
+
+    // Minimum margin
+    result.min_margin_pct = std::min({result.stall_margin_pct, result.vmo_margin_pct, result.mmo_margin_pct});
+
+    // Corner speed estimate
+    result.corner_speed_kts = vs_actual * sqrt_two;  // Vc is almost Vs * sqrt(2)
+
+    return result;
+}
+
+struct EnergyData
+{
+    double specific_energy_ft;
+    double energy_rate_kts;
+    Trend trend;  // 1=increasing, 0=stable, -1=decreasing
+};
+
+inline EnergyData calculate_energy(double tas_kts,
+                                   double altitude_ft,
+                                   double vs_fpm)
+{
+    EnergyData result;
+
+    // Specific energy: Es = h + pow(V, 2)/(2g)
+    double v_ms               = tas_kts * units::kts_to_ms;
+    double h_m                = altitude_ft * units::ft_to_m;
+    double kinetic_energy_m   = (v_ms * v_ms) / (2.0 * units::gravity);
+    double total_energy_m     = h_m + kinetic_energy_m;
+    result.specific_energy_ft = total_energy_m * units::m_to_ft;
+
+    // Energy rate (convert VS to equivalent airspeed change)
+    result.energy_rate_kts = vs_fpm / energy_rate_divisor;  // Simplified
+
+    // Trend
+    if (vs_fpm > energy_trend_threshold)
+    {
+        result.trend = Trend::increasing;
+    }
+    else if (vs_fpm < -energy_trend_threshold)
+    {
+        result.trend = Trend::decreasing;
+    }
+    else
+    {
+        result.trend = Trend::stable;
+    }
+
+    return result;
+}
+
+struct GlideData
+{
+    double still_air_range_nm;
+    double wind_adjusted_range_nm;
+    double glide_ratio;
+    double best_glide_speed_kts;
+};
+
+inline GlideData calculate_glide_reach(double agl_ft,
+                                       double tas_kts,
+                                       double headwind_kts)
+{
+    GlideData result;
+
+    // Assume typical L/D ratio of 12:1 for general aviation
+    result.glide_ratio = typical_glide_ratio;
+
+    // Still air range
+    double range_ft           = agl_ft * result.glide_ratio;
+    result.still_air_range_nm = range_ft / units::nm_to_ft;
+
+    // Wind adjustment (simplified)
+    double wind_effect            = headwind_kts / tas_kts;
+    result.wind_adjusted_range_nm = result.still_air_range_nm * (1.0 - wind_effect);
+
+    // Best glide speed (simplified estimate)
+    result.best_glide_speed_kts = best_glide_multiplier * typical_vs;  // 1.3 * typical Vs
+
+    return result;
+}
+
+// Output comprehensive JSON results (fixed buffer, no iostream formatting state)
+inline void print_json_results(const WindData& wind,
+                               const EnvelopeMargins& envelope,
+                               const EnergyData& energy,
+                               const GlideData& glide,
+                               FILE* out = stdout)  // Reply sink; the daemon redirects per client
+{
+    static char buffer[json::default_buffer_size];
+    json::Writer writer(buffer, sizeof(buffer));
+
+    writer.open_object();
+
+    // Wind
+    writer.open_object("wind");
+    writer.field("speed_kts", wind.speed_kts);
+    writer.field("direction_from", wind.direction_from);
+    writer.field("headwind", wind.headwind);
+    writer.field("crosswind", wind.crosswind);
+    writer.field("gust_factor", wind.gust_factor);
+    writer.close_object();
+
+    // Envelope
+    writer.open_object("envelope");
+    writer.field("stall_margin_pct", envelope.stall_margin_pct);
+    writer.field("vmo_margin_pct", envelope.vmo_margin_pct);
+    writer.field("mmo_margin_pct", envelope.mmo_margin_pct);
+    writer.field("min_margin_pct", envelope.min_margin_pct);
+    writer.field("load_factor", envelope.load_factor);
+    writer.field("corner_speed_kts", envelope.corner_speed_kts);
+    writer.close_object();
+
+    // Energy
+    writer.open_object("energy");
+    writer.field("specific_energy_ft", energy.specific_energy_ft);
+    writer.field("energy_rate_kts", energy.energy_rate_kts);
+    writer.field("trend", static_cast<int32_t>(energy.trend));
+    writer.close_object();
+
+    // Glide
+    writer.open_object("glide");
+    writer.field("still_air_range_nm", glide.still_air_range_nm);
+    writer.field("wind_adjusted_range_nm", glide.wind_adjusted_range_nm);
+    writer.field("glide_ratio", glide.glide_ratio);
+    writer.field("best_glide_speed_kts", glide.best_glide_speed_kts);
+    writer.close_object();
+
+    // Alternate airport combinations (JSF-compliant iterative binomial)
+    writer.open_object("alternate_airports");
+    writer.field("combinations_5_choose_2", binomial_coefficient(5, 2));
+    writer.field("combinations_10_choose_3", binomial_coefficient(10, 3));
+    writer.field("note", "Iterative binomial calculation (JSF-compliant, no recursion)");
+    writer.close_object();
+
+    writer.close_object();
+
+    fwrite(writer.data(), 1, writer.length(), out);
+}
+
+// Ring buffer for managing sensor history.  Sum and sum-of-squares are
+// maintained incrementally in add_reading (subtracting the evicted element),
+// so the per-frame statistics are O(1) regardless of the window size and the
+// window can grow well past 20 samples without a per-frame rescan cost.
+struct SensorHistoryBuffer
+{
+    //  The pre-allocated, fixed-size buffer.
+    std::array<double, max_ias_history> data;
+
+    int32_t head_index   = 0;
+    int32_t current_size = 0;
+
+    // Rolling statistics over the current window
+    double running_sum    = 0.0;
+    double running_sum_sq = 0.0;
+
+    void add_reading(double new_ias)
+    {
+        if (current_size == max_ias_history)
+        {
+            // Window full: the slot being overwritten leaves the statistics
+            double evicted = data[head_index];
+            running_sum -= evicted;
+            running_sum_sq -= evicted * evicted;
+        }
+        else
+        {
+            // The buffer size grows until it's full.
+            current_size++;
+        }
+
+        data[head_index] = new_ias;
+        running_sum += new_ias;
+        running_sum_sq += new_ias * new_ias;
+
+        // Move the head to the next position, wrapping around if necessary.
+        head_index = (head_index + 1) % max_ias_history;
+    }
+
+    double mean() const { return current_size > 0 ? running_sum / current_size : 0.0; }
+
+    double std_dev() const
+    {
+        double result = 0.0;
+        if (current_size > 0)
+        {
+            double m        = mean();
+            double variance = (running_sum_sq / current_size) - (m * m);
+            result          = sqrt(variance);
+        }
+        return result;
+    }
+
+    // IAS turbulence estimate, same definition the full rescan produced
+    double gust_factor() const
+    {
+        return current_size >= min_history_for_stats ? std_dev() / mean() : 0.0;
+    }
+
+    const double* get_data_ptr() const { return data.data(); }
+
+    int32_t get_size() const { return current_size; }
+};
+
+}  // namespace calc
+}  // namespace airv
+
+#endif  // !FLIGHT_CALC
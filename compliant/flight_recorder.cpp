@@ -0,0 +1,279 @@
+// Binary flight recorder for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// The CRC table is generated at compile time; record framing is one fwrite
+// per tick against a stream the C library buffers, so recording costs the
+// compute loop a memcpy.  Replay maps the whole file read-only and derives
+// the record count from the file size and the fixed stride.
+
+#include "flight_recorder.h"
+
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace airv
+{
+namespace rec
+{
+
+namespace
+{
+
+constexpr uint32_t crc_polynomial = 0xEDB88320U;
+
+struct CrcTable
+{
+    uint32_t entries[256];
+};
+
+constexpr CrcTable build_crc_table()
+{
+    CrcTable result{};
+
+    for (uint32_t i = 0; i < 256U; ++i)
+    {
+        uint32_t value = i;
+        for (int32_t bit = 0; bit < 8; ++bit)
+        {
+            value = ((value & 1U) != 0U) ? (crc_polynomial ^ (value >> 1)) : (value >> 1);
+        }
+        result.entries[i] = value;
+    }
+
+    return result;
+}
+
+constexpr CrcTable crc_table = build_crc_table();
+
+}  // namespace
+
+uint32_t crc32(const void* data,
+               size_t length)
+{
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    uint32_t crc         = 0xFFFFFFFFU;
+
+    for (size_t i = 0; i < length; ++i)
+    {
+        crc = crc_table.entries[(crc ^ bytes[i]) & 0xFFU] ^ (crc >> 8);
+    }
+
+    return crc ^ 0xFFFFFFFFU;
+}
+
+Recorder::Recorder()
+    : file_(nullptr),
+      record_count_(0)
+{
+}
+
+bool Recorder::open(const char* path)
+{
+    bool ok = (file_ == nullptr);
+
+    if (ok)
+    {
+        file_ = fopen(path, "ab");
+        ok    = (file_ != nullptr);
+    }
+
+    if (ok && ftell(file_) == 0L)
+    {
+        // Fresh file: write the header before the first record
+        FileHeader header;
+        memset(&header, 0, sizeof(header));
+        header.magic         = recorder_magic;
+        header.version       = recorder_version;
+        header.record_stride = static_cast<uint32_t>(sizeof(Record));
+
+        ok = (fwrite(&header, sizeof(header), 1, file_) == 1);
+        if (!ok)
+        {
+            close();
+        }
+    }
+
+    return ok;
+}
+
+bool Recorder::append(double timestamp_s,
+                      const shm::ExchangeFrame& frame)
+{
+    bool ok = (file_ != nullptr);
+
+    if (ok)
+    {
+        Record record;
+        memset(&record, 0, sizeof(record));
+        record.timestamp_s = timestamp_s;
+        record.in          = frame.in;
+        record.out         = frame.out;
+        record.crc32       = crc32(&record, offsetof(Record, crc32));
+
+        ok = (fwrite(&record, sizeof(record), 1, file_) == 1);
+        if (ok)
+        {
+            ++record_count_;
+        }
+    }
+
+    return ok;
+}
+
+void Recorder::flush()
+{
+    if (file_ != nullptr)
+    {
+        fflush(file_);
+    }
+}
+
+void Recorder::close()
+{
+    if (file_ != nullptr)
+    {
+        fclose(file_);
+        file_ = nullptr;
+    }
+}
+
+ReplayReader::ReplayReader()
+    : mapped_(nullptr),
+      mapped_length_(0),
+      count_(0)
+{
+}
+
+bool ReplayReader::open(const char* path)
+{
+    int fd  = ::open(path, O_RDONLY);
+    bool ok = (fd >= 0);
+
+    struct stat info;
+
+    if (ok)
+    {
+        ok = (fstat(fd, &info) == 0) && (static_cast<size_t>(info.st_size) >= sizeof(FileHeader));
+    }
+    if (ok)
+    {
+        mapped_length_ = static_cast<size_t>(info.st_size);
+        void* mapped   = mmap(nullptr, mapped_length_, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        ok = (mapped != MAP_FAILED);
+        if (ok)
+        {
+            mapped_ = static_cast<const uint8_t*>(mapped);
+        }
+    }
+    if (fd >= 0)
+    {
+        ::close(fd);
+    }
+
+    if (ok)
+    {
+        const FileHeader* header = reinterpret_cast<const FileHeader*>(mapped_);
+
+        ok = (header->magic == recorder_magic) && (header->version == recorder_version) &&
+             (header->record_stride == sizeof(Record));
+        if (ok)
+        {
+            count_ = static_cast<int64_t>((mapped_length_ - sizeof(FileHeader)) / sizeof(Record));
+        }
+        else
+        {
+            close();
+        }
+    }
+
+    return ok;
+}
+
+void ReplayReader::close()
+{
+    if (mapped_ != nullptr)
+    {
+        munmap(const_cast<uint8_t*>(mapped_), mapped_length_);
+        mapped_        = nullptr;
+        mapped_length_ = 0;
+        count_         = 0;
+    }
+}
+
+const Record* ReplayReader::at(int64_t index) const
+{
+    const Record* result = nullptr;
+
+    if (mapped_ != nullptr && index >= 0 && index < count_)
+    {
+        result = reinterpret_cast<const Record*>(
+            mapped_ + sizeof(FileHeader) + (static_cast<size_t>(index) * sizeof(Record)));
+    }
+
+    return result;
+}
+
+bool ReplayReader::crc_ok(int64_t index) const
+{
+    const Record* record = at(index);
+
+    return (record != nullptr) && (crc32(record, offsetof(Record, crc32)) == record->crc32);
+}
+
+int64_t ReplayReader::index_for_time(double timestamp_s) const
+{
+    int64_t result = -1;
+
+    if (count_ > 0)
+    {
+        double first = at(0)->timestamp_s;
+        double last  = at(count_ - 1)->timestamp_s;
+
+        if (count_ == 1 || last <= first || timestamp_s <= first)
+        {
+            result = 0;
+        }
+        else if (timestamp_s >= last)
+        {
+            result = count_ - 1;
+        }
+        else
+        {
+            // Constant-rate estimate, then a short walk for jittery ticks
+            double rate = static_cast<double>(count_ - 1) / (last - first);
+            int64_t estimate = static_cast<int64_t>(((timestamp_s - first) * rate) + 0.5);
+
+            if (estimate < 0)
+            {
+                estimate = 0;
+            }
+            if (estimate >= count_)
+            {
+                estimate = count_ - 1;
+            }
+            while (estimate > 0 && at(estimate)->timestamp_s > timestamp_s)
+            {
+                --estimate;
+            }
+            while (estimate < count_ - 1 && at(estimate + 1)->timestamp_s <= timestamp_s)
+            {
+                ++estimate;
+            }
+            result = estimate;
+        }
+    }
+
+    return result;
+}
+
+double ReplayReader::duration_s() const
+{
+    return (count_ > 1) ? at(count_ - 1)->timestamp_s - at(0)->timestamp_s : 0.0;
+}
+
+}  // namespace rec
+}  // namespace airv
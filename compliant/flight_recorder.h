@@ -0,0 +1,128 @@
+// Binary flight recorder for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// Archives one fixed-stride packed record per computed tick — timestamp,
+// every calculator input and every output (the shm exchange frames) — with
+// a CRC32 trailer per record.  Recording appends through a buffered stream;
+// replay memory-maps the file and returns record pointers straight into the
+// mapping, so reading a 4-hour session parses and copies nothing.  The
+// fixed stride makes seeking to a timestamp O(1) for constant-rate
+// recordings.
+//
+// The input block's leading fields are laid out identically to
+// batch::Sample, so a replay record can be handed to the --batch kernels
+// as a Sample pointer without conversion (see sample_at).
+
+#ifndef FLIGHT_RECORDER
+#define FLIGHT_RECORDER
+
+#include "batch_calc.h"
+#include "shm_exchange.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+namespace airv
+{
+namespace rec
+{
+
+constexpr uint32_t recorder_magic   = 0x4D464452U;  // "MFDR"
+constexpr uint32_t recorder_version = 1U;
+
+struct FileHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t record_stride;  // sizeof(Record); rejects layout drift on open
+    uint32_t reserved;
+};
+
+// One tick: wall-clock seconds plus the full exchange frame
+struct Record
+{
+    double timestamp_s;    // CLOCK_REALTIME seconds at publication
+    shm::InputFrame in;    // Every calculator input
+    shm::OutputFrame out;  // Every calculator output
+    uint32_t crc32;        // Over all preceding bytes of the record
+    uint32_t reserved;
+};
+
+static_assert(sizeof(Record) == sizeof(double) + sizeof(shm::InputFrame) + sizeof(shm::OutputFrame) + 8,
+              "Record must stay packed");
+
+// batch::Sample must remain the leading prefix of InputFrame for the
+// zero-copy replay path
+static_assert(sizeof(batch::Sample) <= sizeof(shm::InputFrame), "Sample exceeds the input block");
+
+// CRC32 (reflected, polynomial 0xEDB88320) over length bytes
+uint32_t crc32(const void* data,
+               size_t length);
+
+// Appends records through one buffered stream; a new file gets a header
+class Recorder
+{
+public:
+    Recorder();
+
+    bool open(const char* path);
+
+    // Frame the record with its CRC and append it (buffered)
+    bool append(double timestamp_s,
+                const shm::ExchangeFrame& frame);
+
+    void flush();
+
+    void close();
+
+    bool is_open() const { return file_ != nullptr; }
+
+    int64_t record_count() const { return record_count_; }
+
+private:
+    FILE* file_;
+    int64_t record_count_;
+};
+
+// Memory-mapped reader; record pointers alias the mapping directly
+class ReplayReader
+{
+public:
+    ReplayReader();
+
+    bool open(const char* path);
+
+    void close();
+
+    int64_t count() const { return count_; }
+
+    // Zero-copy view of one record
+    const Record* at(int64_t index) const;
+
+    // The record's inputs viewed as a batch Sample (no conversion)
+    const batch::Sample* sample_at(int64_t index) const
+    {
+        const Record* record = at(index);
+        return (record != nullptr) ? reinterpret_cast<const batch::Sample*>(&record->in) : nullptr;
+    }
+
+    // Validate one record's CRC frame
+    bool crc_ok(int64_t index) const;
+
+    // Index of the record nearest timestamp_s.  O(1) for constant-rate
+    // recordings: the index is estimated from the first/last timestamps and
+    // fixed up by a short bounded walk.
+    int64_t index_for_time(double timestamp_s) const;
+
+    double duration_s() const;
+
+private:
+    const uint8_t* mapped_;
+    size_t mapped_length_;
+    int64_t count_;
+};
+
+}  // namespace rec
+}  // namespace airv
+
+#endif  // !FLIGHT_RECORDER
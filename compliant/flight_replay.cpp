@@ -0,0 +1,310 @@
+// Flight recording replay tool for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// Inspects recordings written by the flight recorder (see
+// flight_recorder.h).  The file is memory-mapped; every operation works on
+// record pointers into the mapping with zero parsing.
+//
+//   flight_replay <file.rec>                  summary and full CRC sweep
+//   flight_replay <file.rec> --at=<seconds>   dump the record nearest a
+//                                             timestamp (offset from start)
+//   flight_replay <file.rec> --extract=<out>  write the input blocks as raw
+//                                             batch Samples for --batch
+//   flight_replay --reprocess[=<workers>] <file.rec> [<file.rec> ...]
+//                                             rerun the flight kernels over a
+//                                             whole archive in parallel with
+//                                             the work-stealing scheduler (see
+//                                             replay_scheduler.h); each input
+//                                             gets a <file.rec>.out of raw
+//                                             batch FlightResult records
+
+#include "flight_recorder.h"
+#include "json_writer.h"
+#include "replay_scheduler.h"
+#include "xplane_mfd_calc.h"
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <iostream>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace
+{
+
+void print_usage(const char* program_name)
+{
+    std::cerr << "Usage: " << program_name << " <file.rec> [--at=<seconds>] [--extract=<out.bin>]\n"
+              << "       " << program_name << " --reprocess[=<workers>] <file.rec> [<file.rec> ...]\n";
+}
+
+// Summary plus CRC sweep over every record
+int32_t verify(const airv::rec::ReplayReader& reader)
+{
+    int64_t bad = 0;
+
+    for (int64_t i = 0; i < reader.count(); ++i)
+    {
+        if (!reader.crc_ok(i))
+        {
+            ++bad;
+        }
+    }
+
+    static char buffer[airv::json::default_buffer_size];
+    airv::json::Writer writer(buffer, sizeof(buffer));
+
+    writer.open_object();
+    writer.field("records", static_cast<uint64_t>(reader.count()));
+    writer.field("duration_s", reader.duration_s());
+    writer.field("crc_failures", static_cast<uint64_t>(bad));
+    writer.close_object();
+    fwrite(writer.data(), 1, writer.length(), stdout);
+
+    return (bad == 0) ? 0 : 1;
+}
+
+// Dump the record nearest start-relative seconds
+int32_t dump_at(const airv::rec::ReplayReader& reader,
+                double offset_s)
+{
+    int32_t result = 1;
+
+    if (reader.count() > 0)
+    {
+        int64_t index                   = reader.index_for_time(reader.at(0)->timestamp_s + offset_s);
+        const airv::rec::Record* record = reader.at(index);
+
+        static char buffer[airv::json::default_buffer_size];
+        airv::json::Writer writer(buffer, sizeof(buffer));
+
+        writer.open_object();
+        writer.field("index", static_cast<uint64_t>(index));
+        writer.field("offset_s", record->timestamp_s - reader.at(0)->timestamp_s);
+        writer.field_bool("crc_ok", reader.crc_ok(index));
+        writer.open_object("inputs");
+        writer.field("tas_kts", record->in.tas_kts);
+        writer.field("gs_kts", record->in.gs_kts);
+        writer.field("heading_deg", record->in.heading_deg);
+        writer.field("track_deg", record->in.track_deg);
+        writer.field("ias_kts", record->in.ias_kts);
+        writer.field("altitude_ft", record->in.altitude_ft);
+        writer.field("vs_fpm", record->in.vs_fpm);
+        writer.close_object();
+        writer.open_object("outputs");
+        writer.field("wind_speed_kts", record->out.wind_speed_kts);
+        writer.field("wind_headwind", record->out.wind_headwind);
+        writer.field("stall_margin_pct", record->out.stall_margin_pct);
+        writer.field("min_margin_pct", record->out.min_margin_pct);
+        writer.field("specific_energy_ft", record->out.specific_energy_ft);
+        writer.field("wind_adjusted_range_nm", record->out.wind_adjusted_range_nm);
+        writer.close_object();
+        writer.close_object();
+        fwrite(writer.data(), 1, writer.length(), stdout);
+
+        result = 0;
+    }
+
+    return result;
+}
+
+// Write every record's input block as a raw batch Sample stream
+int32_t extract(const airv::rec::ReplayReader& reader,
+                const char* out_path)
+{
+    FILE* out  = fopen(out_path, "wb");
+    bool ok    = (out != nullptr);
+    int64_t n  = 0;
+
+    for (int64_t i = 0; ok && i < reader.count(); ++i)
+    {
+        // sample_at aliases the mapping; the only copy is into the stream
+        ok = (fwrite(reader.sample_at(i), sizeof(airv::batch::Sample), 1, out) == 1);
+        if (ok)
+        {
+            ++n;
+        }
+    }
+
+    if (out != nullptr && fclose(out) != 0)
+    {
+        ok = false;
+    }
+
+    if (ok)
+    {
+        std::cerr << "Extracted " << n << " samples to " << out_path << "\n";
+    }
+    else
+    {
+        std::cerr << "Error: Extract failed\n";
+    }
+
+    return ok ? 0 : 1;
+}
+
+// Rerun the flight kernels over every archive file across all cores.
+// Outputs are created up front at their final size and memory-mapped, so
+// the workers scatter results straight into the page cache.
+int32_t reprocess(const char* flag,       // "--reprocess" or "--reprocess=<workers>"
+                  int32_t file_count,
+                  char* const* paths)
+{
+    static airv::rec::ReplayReader readers[airv::sched::max_replay_flights];
+    static airv::batch::FlightResult* outputs[airv::sched::max_replay_flights];
+    static int output_fds[airv::sched::max_replay_flights];
+    static airv::sched::ReplayScheduler scheduler;
+
+    if (file_count > airv::sched::max_replay_flights)
+    {
+        std::cerr << "Error: At most " << airv::sched::max_replay_flights << " recordings per run\n";
+        return 1;
+    }
+
+    // Default to one worker per online core, clamped by the scheduler
+    int32_t workers = static_cast<int32_t>(sysconf(_SC_NPROCESSORS_ONLN));
+    if (strncmp(flag, "--reprocess=", 12) == 0)
+    {
+        workers = static_cast<int32_t>(strtol(&flag[12], nullptr, 10));
+    }
+
+    bool ok = true;
+
+    for (int32_t i = 0; ok && i < file_count; ++i)
+    {
+        outputs[i]    = nullptr;
+        output_fds[i] = -1;
+
+        if (!readers[i].open(paths[i]))
+        {
+            std::cerr << "Error: Cannot open recording " << paths[i] << "\n";
+            ok = false;
+        }
+        else
+        {
+            static char out_path[512];
+            snprintf(out_path, sizeof(out_path), "%s.out", paths[i]);
+
+            size_t bytes  = static_cast<size_t>(readers[i].count()) * sizeof(airv::batch::FlightResult);
+            output_fds[i] = open(out_path, O_CREAT | O_RDWR | O_TRUNC, 0644);
+
+            ok = (output_fds[i] >= 0) && (ftruncate(output_fds[i], static_cast<off_t>(bytes)) == 0);
+            if (ok && bytes > 0)
+            {
+                void* mapped = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, output_fds[i], 0);
+
+                ok = (mapped != MAP_FAILED);
+                if (ok)
+                {
+                    outputs[i] = static_cast<airv::batch::FlightResult*>(mapped);
+                    ok         = scheduler.add_flight(readers[i], outputs[i]);
+                }
+            }
+            if (!ok)
+            {
+                std::cerr << "Error: Cannot create output " << out_path << "\n";
+            }
+        }
+    }
+
+    airv::sched::ReplayStats stats;
+    double elapsed_s = 0.0;
+
+    if (ok)
+    {
+        struct timespec begin;
+        struct timespec finish;
+
+        clock_gettime(CLOCK_MONOTONIC, &begin);
+        ok = scheduler.run(workers, stats);
+        clock_gettime(CLOCK_MONOTONIC, &finish);
+
+        elapsed_s = static_cast<double>(finish.tv_sec - begin.tv_sec) +
+                    (static_cast<double>(finish.tv_nsec - begin.tv_nsec) * 1.0e-9);
+    }
+
+    for (int32_t i = 0; i < file_count; ++i)
+    {
+        if (outputs[i] != nullptr)
+        {
+            munmap(outputs[i], static_cast<size_t>(readers[i].count()) * sizeof(airv::batch::FlightResult));
+        }
+        if (output_fds[i] >= 0)
+        {
+            close(output_fds[i]);
+        }
+        readers[i].close();
+    }
+
+    if (ok)
+    {
+        static char buffer[airv::json::default_buffer_size];
+        airv::json::Writer writer(buffer, sizeof(buffer));
+
+        writer.open_object();
+        writer.field("flights", file_count);
+        writer.field("records", static_cast<uint64_t>(stats.records));
+        writer.field("chunks", static_cast<uint64_t>(stats.chunks));
+        writer.field("workers", stats.workers);
+        writer.field("steals", static_cast<uint64_t>(stats.steals));
+        writer.field("elapsed_s", elapsed_s);
+        writer.field("records_per_s", (elapsed_s > 0.0) ? static_cast<double>(stats.records) / elapsed_s : 0.0);
+        writer.close_object();
+        fwrite(writer.data(), 1, writer.length(), stdout);
+    }
+
+    return ok ? 0 : 1;
+}
+
+}  // namespace
+
+int main(int argc,
+         char* argv[])
+{
+    if (argc >= 3 && strncmp(argv[1], "--reprocess", 11) == 0)
+    {
+        return (reprocess(argv[1], argc - 2, &argv[2]) == 0)
+                   ? static_cast<int>(airv::Return_code::success)
+                   : static_cast<int>(airv::Return_code::invalid_value);
+    }
+
+    if (argc < 2 || argc > 3)
+    {
+        print_usage(argv[0]);
+        return static_cast<int>(airv::Return_code::invalid_argc);
+    }
+
+    airv::rec::ReplayReader reader;
+    if (!reader.open(argv[1]))
+    {
+        std::cerr << "Error: Cannot open recording " << argv[1] << "\n";
+        return static_cast<int>(airv::Return_code::invalid_value);
+    }
+
+    int32_t result = 0;
+
+    if (argc == 2)
+    {
+        result = verify(reader);
+    }
+    else if (strncmp(argv[2], "--at=", 5) == 0)
+    {
+        result = dump_at(reader, strtod(&argv[2][5], nullptr));
+    }
+    else if (strncmp(argv[2], "--extract=", 10) == 0)
+    {
+        result = extract(reader, &argv[2][10]);
+    }
+    else
+    {
+        print_usage(argv[0]);
+        result = 1;
+    }
+
+    reader.close();
+
+    return (result == 0) ? static_cast<int>(airv::Return_code::success)
+                         : static_cast<int>(airv::Return_code::invalid_value);
+}
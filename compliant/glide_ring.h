@@ -0,0 +1,106 @@
+// 360-degree glide range ring for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// calculate_glide_reach returns one wind-adjusted range along the current
+// track; the MFD draws a full ring of reachable ground distance in every
+// direction.  The ring sweep uses a sin/cos table built once when the
+// radial count is configured, so the per-frame work is one multiply-add
+// pair per radial over contiguous arrays — a loop the compiler vectorizes
+// — with no trig calls on the frame path even at 256 radials.
+
+#ifndef GLIDE_RING
+#define GLIDE_RING
+
+#include "flight_calc.h"
+#include "xplane_mfd_calc.h"
+#include <cmath>
+#include <cstdint>
+
+namespace airv
+{
+namespace calc
+{
+
+// Radial limits; 72 gives the display a 5-degree ring step
+constexpr int32_t max_glide_radials     = 256;
+constexpr int32_t default_glide_radials = 72;
+
+// Sin/cos of each ring bearing, precomputed when the count is chosen
+struct RadialTable
+{
+    int32_t count;
+    double sin_t[max_glide_radials];
+    double cos_t[max_glide_radials];
+
+    RadialTable()
+        : count(0)
+    {
+    }
+};
+
+// Build the table for count evenly spaced bearings from north; clamps the
+// count into [1, max_glide_radials]
+inline void build_radial_table(int32_t count,
+                               RadialTable& table)
+{
+    if (count < 1)
+    {
+        count = 1;
+    }
+    if (count > max_glide_radials)
+    {
+        count = max_glide_radials;
+    }
+
+    double step_rad = (360.0 / count) * units::deg_to_rad;
+
+    table.count = count;
+    for (int32_t i = 0; i < count; ++i)
+    {
+        table.sin_t[i] = sin(step_rad * i);
+        table.cos_t[i] = cos(step_rad * i);
+    }
+}
+
+// Wind-adjusted glide range on every ring bearing, in table order
+struct GlideRing
+{
+    int32_t radial_count;
+    double range_nm[max_glide_radials];
+};
+
+// Sweep the ring.  The headwind on bearing b follows the sign convention
+// of wind_components_on_track, -speed * cos(direction_from - b), expanded
+// so the loop body is two multiply-adds against the precomputed tables —
+// the radial on the current track matches calculate_glide_reach exactly.
+// Ranges clamp at zero when the headwind exceeds the glide speed.
+inline void calculate_glide_ring(const RadialTable& table,
+                                 double agl_ft,
+                                 double tas_kts,
+                                 const WindData& wind,
+                                 GlideRing& ring,
+                                 double glide_ratio = typical_glide_ratio)
+{
+    double still_air_nm = (agl_ft * glide_ratio) / units::nm_to_ft;
+    double dir_rad      = wind.direction_from * units::deg_to_rad;
+
+    // Wind vector components reused by every radial
+    double wind_north = wind.speed_kts * cos(dir_rad);
+    double wind_east  = wind.speed_kts * sin(dir_rad);
+
+    double range_per_headwind = (tas_kts > 0.0) ? still_air_nm / tas_kts : 0.0;
+
+    ring.radial_count = table.count;
+    for (int32_t i = 0; i < table.count; ++i)
+    {
+        double headwind = -((wind_north * table.cos_t[i]) + (wind_east * table.sin_t[i]));
+        double range    = still_air_nm - (headwind * range_per_headwind);
+
+        ring.range_nm[i] = (range > 0.0) ? range : 0.0;
+    }
+}
+
+}  // namespace calc
+}  // namespace airv
+
+#endif  // !GLIDE_RING
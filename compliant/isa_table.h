@@ -0,0 +1,162 @@
+// Compile-time ISA atmosphere table for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// pow() dominates the density altitude profile, so the standard-atmosphere
+// pressure ratio and ISA temperature are tabulated at compile time every
+// 100 ft across the validated altitude range and linearly interpolated at
+// runtime.  Grid-point inputs reproduce the closed form to the last ulp of
+// the constexpr evaluation; between points the interpolation error is far
+// below the display resolution.  The closed-form functions stay available
+// for --exact verification runs.
+
+#ifndef ISA_TABLE
+#define ISA_TABLE
+
+#include <cstdint>
+
+namespace airv
+{
+namespace calc
+{
+
+// ISA model constants (shared with the closed-form path)
+constexpr double sea_level_temp_c           = 15.0;
+constexpr double temp_lapse_rate            = 0.0019812;  // Celsius per foot (standard lapse rate)
+constexpr double kelvin_offset              = 273.15;
+constexpr double pressure_altitude_constant = 6.8756e-6;
+constexpr double pressure_altitude_exponent = 5.2559;
+
+// Validation ranges: warning if input is not in range (also the table span)
+constexpr double min_altitude_ft = -2000.0;
+constexpr double max_altitude_ft = 60000.0;
+
+namespace isa
+{
+
+constexpr double table_step_ft = 100.0;
+constexpr int32_t table_size   = static_cast<int32_t>((max_altitude_ft - min_altitude_ft) / table_step_ft) + 1;
+
+// ln(x) by the artanh series, valid for the pressure bases in the table span
+constexpr double cx_ln(double x)
+{
+    double t    = (x - 1.0) / (x + 1.0);
+    double t_sq = t * t;
+    double term = t;
+    double sum  = 0.0;
+
+    for (int32_t n = 0; n < 60; ++n)
+    {
+        sum += term / static_cast<double>((2 * n) + 1);
+        term *= t_sq;
+    }
+
+    return 2.0 * sum;
+}
+
+// exp(x) by Taylor series; negative arguments go through the reciprocal to
+// avoid alternating-sum cancellation
+constexpr double cx_exp(double x)
+{
+    double arg  = x < 0.0 ? -x : x;
+    double term = 1.0;
+    double sum  = 1.0;
+
+    for (int32_t n = 1; n < 60; ++n)
+    {
+        term *= arg / static_cast<double>(n);
+        sum += term;
+    }
+
+    return x < 0.0 ? 1.0 / sum : sum;
+}
+
+constexpr double cx_pow(double base,
+                        double exponent)
+{
+    return cx_exp(exponent * cx_ln(base));
+}
+
+struct Entry
+{
+    double pressure_ratio;  // P / P0 at this pressure altitude
+    double isa_temp_c;      // ISA temperature at this pressure altitude
+};
+
+struct Table
+{
+    Entry entries[table_size];
+};
+
+constexpr Table build_table()
+{
+    Table result{};
+
+    for (int32_t i = 0; i < table_size; ++i)
+    {
+        double alt_ft = min_altitude_ft + (static_cast<double>(i) * table_step_ft);
+
+        result.entries[i].pressure_ratio =
+            cx_pow(1.0 - (pressure_altitude_constant * alt_ft), pressure_altitude_exponent);
+        result.entries[i].isa_temp_c = sea_level_temp_c - (temp_lapse_rate * alt_ft);
+    }
+
+    return result;
+}
+
+constexpr Table table = build_table();
+
+// Interpolation weights for one altitude; inputs outside the span clamp to
+// the table edges (the CLI already warns about them)
+struct Lookup
+{
+    int32_t index;
+    double fraction;
+};
+
+inline Lookup locate(double pressure_altitude_ft)
+{
+    Lookup result;
+    double offset = (pressure_altitude_ft - min_altitude_ft) / table_step_ft;
+
+    if (offset <= 0.0)
+    {
+        result.index    = 0;
+        result.fraction = 0.0;
+    }
+    else if (offset >= static_cast<double>(table_size - 1))
+    {
+        result.index    = table_size - 2;
+        result.fraction = 1.0;
+    }
+    else
+    {
+        result.index    = static_cast<int32_t>(offset);
+        result.fraction = offset - static_cast<double>(result.index);
+    }
+
+    return result;
+}
+
+inline double pressure_ratio(double pressure_altitude_ft)
+{
+    Lookup at        = locate(pressure_altitude_ft);
+    const Entry& lo  = table.entries[at.index];
+    const Entry& hi  = table.entries[at.index + 1];
+
+    return lo.pressure_ratio + (at.fraction * (hi.pressure_ratio - lo.pressure_ratio));
+}
+
+inline double temperature_c(double pressure_altitude_ft)
+{
+    Lookup at        = locate(pressure_altitude_ft);
+    const Entry& lo  = table.entries[at.index];
+    const Entry& hi  = table.entries[at.index + 1];
+
+    return lo.isa_temp_c + (at.fraction * (hi.isa_temp_c - lo.isa_temp_c));
+}
+
+}  // namespace isa
+}  // namespace calc
+}  // namespace airv
+
+#endif  // !ISA_TABLE
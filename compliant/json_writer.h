@@ -0,0 +1,309 @@
+// Zero-allocation JSON writer for X-Plane MFD calculators
+// JSF AV C++ Coding Standard Compliant Version
+//
+// Formats results into a caller-provided fixed buffer with no iostream
+// locale machinery and no heap traffic.  Doubles are emitted as fixed
+// two-decimal text via integer scaling (the schema the MFD already parses);
+// exact binary ties may round differently from printf's half-even in the
+// last digit, which is below the display's resolution.  The writer tracks
+// nesting depth and comma placement so call sites read like the schema.
+
+#ifndef JSON_WRITER
+#define JSON_WRITER
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+namespace airv
+{
+namespace json
+{
+
+// Large enough for the biggest reply (flight results with every section)
+constexpr size_t default_buffer_size = 4096;
+
+// Indentation step, matching the iostream output this replaces
+constexpr int32_t indent_width = 2;
+
+// |values| at or above this cannot be scaled through int64; fall back to stdio
+constexpr double max_scalable = 9.0e15;
+
+// Render value with exactly two decimals; returns characters written
+inline size_t format_fixed2(double value,   // Value to format
+                            char* out,      // Output buffer
+                            size_t cap)     // Buffer capacity
+{
+    size_t written = 0;
+
+    if (std::isnan(value) || std::isinf(value) || fabs(value) >= max_scalable)
+    {
+        // Rare paths go through stdio; the fast path below never does
+        int n = snprintf(out, cap, "%.2f", value);
+        written = (n > 0 && static_cast<size_t>(n) < cap) ? static_cast<size_t>(n) : 0;
+    }
+    else
+    {
+        char digits[32];
+        int32_t digit_count = 0;
+        bool negative       = std::signbit(value);
+        uint64_t scaled     = static_cast<uint64_t>(fabs(value) * 100.0 + 0.5);
+        uint64_t whole      = scaled / 100U;
+        uint64_t frac       = scaled % 100U;
+
+        do
+        {
+            digits[digit_count] = static_cast<char>('0' + (whole % 10U));
+            ++digit_count;
+            whole /= 10U;
+        } while (whole > 0U);
+
+        size_t needed = static_cast<size_t>(digit_count) + 3U + (negative ? 1U : 0U);
+        if (needed <= cap)
+        {
+            if (negative)
+            {
+                out[written] = '-';
+                ++written;
+            }
+            while (digit_count > 0)
+            {
+                --digit_count;
+                out[written] = digits[digit_count];
+                ++written;
+            }
+            out[written] = '.';
+            ++written;
+            out[written] = static_cast<char>('0' + (frac / 10U));
+            ++written;
+            out[written] = static_cast<char>('0' + (frac % 10U));
+            ++written;
+        }
+    }
+
+    return written;
+}
+
+// Streaming writer over a caller-provided buffer
+class Writer
+{
+public:
+    Writer(char* buffer,     // Caller-provided output storage
+           size_t capacity)  // Bytes available in buffer
+        : buffer_(buffer),
+          capacity_(capacity),
+          length_(0),
+          depth_(0),
+          need_comma_(false),
+          truncated_(false)
+    {
+    }
+
+    // Top-level or nested "{"; nested objects take the member key
+    void open_object()
+    {
+        start_item();
+        append_indent();  // Writes nothing at the top level
+        append("{\n");
+        ++depth_;
+        need_comma_ = false;
+    }
+
+    void open_object(const char* key)
+    {
+        start_item();
+        append_indent();
+        append_key(key);
+        append("{\n");
+        ++depth_;
+        need_comma_ = false;
+    }
+
+    void field(const char* key,
+               double value)
+    {
+        char number[48];
+        size_t n = format_fixed2(value, number, sizeof(number));
+        number[n] = '\0';
+        field_raw(key, number);
+    }
+
+    void field(const char* key,
+               uint64_t value)
+    {
+        char number[24];
+        int n = snprintf(number, sizeof(number), "%llu", static_cast<unsigned long long>(value));
+        if (n <= 0)
+        {
+            number[0] = '\0';
+        }
+        field_raw(key, number);
+    }
+
+    void field(const char* key,
+               int32_t value)
+    {
+        char number[16];
+        int n = snprintf(number, sizeof(number), "%d", value);
+        if (n <= 0)
+        {
+            number[0] = '\0';
+        }
+        field_raw(key, number);
+    }
+
+    void field(const char* key,
+               const char* value)  // Quoted string member
+    {
+        start_item();
+        append_indent();
+        append_key(key);
+        append("\"");
+        append(value);
+        append("\"");
+        need_comma_ = true;
+    }
+
+    void field_bool(const char* key,
+                    bool value)
+    {
+        field_raw(key, value ? "true" : "false");
+    }
+
+    // Unquoted literal member (numbers, true/false)
+    void field_raw(const char* key,
+                   const char* literal)
+    {
+        start_item();
+        append_indent();
+        append_key(key);
+        append(literal);
+        need_comma_ = true;
+    }
+
+    void close_object()
+    {
+        append("\n");
+        --depth_;
+        append_indent();
+        append("}");
+        if (depth_ == 0)
+        {
+            append("\n");
+        }
+        need_comma_ = true;
+    }
+
+    // Array member; elements are keyless open_object()/close_object() pairs
+    void open_array(const char* key)
+    {
+        start_item();
+        append_indent();
+        append_key(key);
+        append("[\n");
+        ++depth_;
+        need_comma_ = false;
+    }
+
+    void close_array()
+    {
+        append("\n");
+        --depth_;
+        append_indent();
+        append("]");
+        need_comma_ = true;
+    }
+
+    // Keyless scalar array elements
+    void item(double value)
+    {
+        char number[48];
+        size_t n  = format_fixed2(value, number, sizeof(number));
+        number[n] = '\0';
+        start_item();
+        append_indent();
+        append(number);
+        need_comma_ = true;
+    }
+
+    void item(uint64_t value)
+    {
+        char number[24];
+        int n = snprintf(number, sizeof(number), "%llu", static_cast<unsigned long long>(value));
+        if (n <= 0)
+        {
+            number[0] = '\0';
+        }
+        start_item();
+        append_indent();
+        append(number);
+        need_comma_ = true;
+    }
+
+    const char* data() const { return buffer_; }
+
+    size_t length() const { return length_; }
+
+    // False if the buffer was too small; output is then incomplete
+    bool ok() const { return !truncated_; }
+
+private:
+    void start_item()
+    {
+        if (need_comma_)
+        {
+            append(",\n");
+        }
+    }
+
+    void append_indent()
+    {
+        for (int32_t level = 0; level < depth_ * indent_width; ++level)
+        {
+            push(' ');
+        }
+    }
+
+    void append_key(const char* key)
+    {
+        append("\"");
+        append(key);
+        append("\": ");
+    }
+
+    void append(const char* text)
+    {
+        while (*text != '\0')
+        {
+            push(*text);
+            ++text;
+        }
+    }
+
+    void push(char c)
+    {
+        if (length_ < capacity_)
+        {
+            buffer_[length_] = c;
+            ++length_;
+        }
+        else
+        {
+            truncated_ = true;
+        }
+    }
+
+    char* buffer_;
+    size_t capacity_;
+    size_t length_;
+    int32_t depth_;
+    bool need_comma_;
+    bool truncated_;
+};
+
+}  // namespace json
+}  // namespace airv
+
+#endif  // !JSON_WRITER
@@ -0,0 +1,1081 @@
+// Calculation Daemon for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// Long-running replacement for the per-sample calculator processes.  The MFD
+// writes one framed request per line on stdin:
+//
+//   wind    <track> <heading> <wind_dir> <wind_speed>
+//   flight  <tas> <gs> <heading> <track> <ias> <mach> <alt> <agl> <vs> <weight> <bank> <vso> <vne> <mmo>
+//   turn    <tas_kts> <bank_deg> <course_change_deg>
+//   vnav    <current_alt> <target_alt> <distance_nm> <groundspeed> <current_vs>
+//   vnavplan <count> <current_alt> <groundspeed>
+//           (followed by <count> lines of <distance> <alt_min> <alt_max> <speed>)
+//   density <pressure_alt> <oat_celsius> <ias_kts> <tas_kts>
+//   ring    <tas> <gs> <heading> <track> <agl> [radials]   (glide range ring)
+//   arc     <tas> <bank> <course_change> <heading> [points] (turn trajectory)
+//   traffic <count>       (followed by <count> lines of 10 aircraft-state values)
+//   shear   <altitude_ft> (wind shear across altitude; see wind_history.h)
+//   energy                (tiered energy-history aggregates; see energy_history.h)
+//   perf [reset]          (latency histograms per pipeline stage; see perf_timers.h)
+//   quit
+//
+// Each reply is the same JSON the standalone calculator would print, followed
+// by one empty line as the frame terminator.  Dispatch goes straight to the
+// calculation cores, so no fork/exec happens per sample.
+
+// With --shm[=name] every computed result is additionally published into the
+// binary shared-memory exchange segment (see shm_exchange.h), so the display
+// can read the latest frame with zero copies and zero parsing.
+//
+// With --record=path every published frame is also appended to a binary
+// flight recording (see flight_recorder.h) for incident review.
+//
+// With --profile=<type> the envelope/glide/turn math runs the compile-time
+// specialized kernels for that aircraft type (see aircraft_profile.h)
+// instead of the generic kernels fed from per-request limit arguments.
+//
+// Every request is timed through the receive/compute/serialize/publish
+// stages into log2 latency histograms; the "perf" command dumps them as
+// JSON and "perf reset" clears them.
+//
+// With --mcast[=group:port] every computed result is also emitted as one
+// UDP multicast datagram carrying the same packed ExchangeFrame (see
+// udp_publisher.h), sequence-numbered so receivers detect loss; one send
+// reaches every subscribed listener on the segment.
+//
+// With --socket=path the daemon serves multiple concurrent clients on a
+// Unix stream socket through a single-threaded epoll loop (see
+// event_server.h) instead of stdin/stdout.  Each request is computed
+// once and the reply fans out to every connected display head; a stalled
+// head drops frames at its own fixed output limit without slowing the
+// others.
+
+#include "aircraft_profile.h"
+#include "density_altitude_calc.h"
+#include "energy_history.h"
+#include "event_server.h"
+#include "fixed_alloc.h"
+#include "flight_calc.h"
+#include "flight_recorder.h"
+#include "glide_ring.h"
+#include "perf_timers.h"
+#include "turn_arc.h"
+#include "shm_exchange.h"
+#include "traffic_engine.h"
+#include "turn_calc.h"
+#include "udp_publisher.h"
+#include "vnav_calc.h"
+#include "vnav_profile.h"
+#include "wind_calc.h"
+#include "wind_history.h"
+#include "xplane_mfd_calc.h"
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+
+namespace airv
+{
+namespace daemon
+{
+
+// Fixed request frame limits
+constexpr int32_t max_line_length = 512;
+constexpr int32_t max_tokens      = 16;
+
+// Every ship contributes ~17 two-decimal fields to the traffic reply
+constexpr size_t traffic_buffer_size = 64U * 1024U;
+
+// Per-request scratch: the largest request (traffic) needs the ship
+// state/result arrays plus the reply buffer, ~80 KB
+constexpr size_t scratch_arena_bytes = 128U * 1024U;
+
+// Socket-mode reply capture; sized for the largest (traffic) reply
+constexpr size_t reply_buffer_bytes = traffic_buffer_size;
+
+// Continuation-line source for multi-line requests: stdin on the classic
+// pipe, the requesting client's buffered frame in socket mode
+typedef bool (*ReadLineFn)(void* context,
+                           char* line,
+                           int32_t capacity);
+
+// Everything one request touches; bundled so dispatch stays within the
+// JSF parameter limit as options accumulate
+struct DaemonState
+{
+    calc::SensorHistoryBuffer ias_buffer;      // Persistent IAS history across requests
+    shm::ExchangeFrame frame;                  // Accumulated inputs/outputs for the exchange segment
+    shm::ExchangeWriter shm_writer;            // Publishes frame when --shm is active
+    rec::Recorder recorder;                    // Appends frames when --record is active
+    net::MulticastPublisher mcast;             // Emits frames as datagrams when --mcast is active
+    traffic::TrafficEngine engine;             // Worker pool for multi-aircraft frames
+    const prof::ProfileKernels* profile;       // Specialized kernels when --profile is active
+    calc::RadialTable radial_table;            // Glide-ring bearings, rebuilt when the count changes
+    calc::VNAVPlanner vnav_planner;            // Arrival profile, replanned from the last change
+    calc::WindHistory wind_history;            // Altitude-banded wind estimates from flight frames
+    calc::EnergyHistory energy_history;        // Tiered energy rings fed from flight frames
+    utils::Arena<scratch_arena_bytes> scratch; // Per-request scratch, reset before each dispatch
+    perf::StageSet perf;                       // Per-stage latency histograms
+    FILE* sink;                                // Reply sink: stdout, or the capture buffer in socket mode
+    ReadLineFn read_line;                      // Continuation-line source for multi-line requests
+    void* read_context;                        // Passed back to read_line
+    bool text_output;                          // False with --format=binary: shm only, no JSON text
+
+    DaemonState()
+        : profile(nullptr),
+          sink(stdout),
+          read_line(nullptr),
+          read_context(nullptr),
+          text_output(true)
+    {
+        memset(&frame, 0, sizeof(frame));
+    }
+};
+
+// Tokenize a request line in place; returns the token count
+int32_t tokenize(char* line,                 // Request line (modified in place)
+                 const char** tokens,        // Output token pointers
+                 int32_t max_token_count)    // Capacity of the token array
+{
+    int32_t count = 0;
+    char* cursor  = line;
+
+    while (*cursor != '\0' && count < max_token_count)
+    {
+        // Skip leading whitespace
+        while (*cursor == ' ' || *cursor == '\t')
+        {
+            ++cursor;
+        }
+        if (*cursor == '\0')
+        {
+            break;
+        }
+        tokens[count] = cursor;
+        ++count;
+
+        // Find the end of the token
+        while (*cursor != '\0' && *cursor != ' ' && *cursor != '\t')
+        {
+            ++cursor;
+        }
+        if (*cursor != '\0')
+        {
+            *cursor = '\0';
+            ++cursor;
+        }
+    }
+
+    return count;
+}
+
+// Parse the numeric arguments of a request; returns false on any bad token
+bool parse_args(const char** tokens,   // Token pointers (tokens[0] is the command)
+                int32_t token_count,   // Total token count including the command
+                double* values,        // Output values
+                int32_t value_count)   // Expected argument count
+{
+    bool ok = (token_count == value_count + 1);
+
+    for (int32_t i = 0; ok && i < value_count; ++i)
+    {
+        ok = utils::parse_double(tokens[i + 1], values[i]);
+    }
+
+    return ok;
+}
+
+// Report a malformed request without terminating the daemon
+void print_error(const char* message,
+                 FILE* out)
+{
+    fprintf(out, "{\n  \"error\": \"%s\"\n}\n", message);
+}
+
+// Emit the one-snapshot traffic reply: every ship's envelope/turn/energy
+void print_traffic_json(const traffic::TrafficResult* results,
+                        int32_t count,
+                        char* buffer,         // Arena-backed reply buffer
+                        size_t buffer_size,
+                        FILE* out)            // Reply sink
+{
+    json::Writer writer(buffer, buffer_size);
+
+    writer.open_object();
+    writer.field("aircraft_count", count);
+    writer.open_array("aircraft");
+    for (int32_t i = 0; i < count; ++i)
+    {
+        const traffic::TrafficResult& ship = results[i];
+
+        writer.open_object();
+        writer.field("stall_margin_pct", ship.envelope.stall_margin_pct);
+        writer.field("vmo_margin_pct", ship.envelope.vmo_margin_pct);
+        writer.field("mmo_margin_pct", ship.envelope.mmo_margin_pct);
+        writer.field("min_margin_pct", ship.envelope.min_margin_pct);
+        writer.field("load_factor", ship.envelope.load_factor);
+        writer.field("corner_speed_kts", ship.envelope.corner_speed_kts);
+        writer.field("radius_nm", ship.turn.radius_nm);
+        writer.field("turn_rate_dps", ship.turn.turn_rate_dps);
+        writer.field("lead_distance_nm", ship.turn.lead_distance_nm);
+        writer.field("time_to_turn_sec", ship.turn.time_to_turn_sec);
+        writer.field("specific_energy_ft", ship.energy.specific_energy_ft);
+        writer.field("energy_rate_kts", ship.energy.energy_rate_kts);
+        writer.field("energy_trend", static_cast<int32_t>(ship.energy.trend));
+        writer.close_object();
+    }
+    writer.close_array();
+    writer.close_object();
+
+    fwrite(writer.data(), 1, writer.length(), out);
+}
+
+// Read <count> aircraft-state lines and evaluate them on the worker pool
+void handle_traffic(const char** tokens,   // Header tokens ("traffic" <count>)
+                    int32_t token_count,   // Header token count
+                    DaemonState& state)
+{
+    traffic::TrafficState* states =
+        state.scratch.allocate_array<traffic::TrafficState>(traffic::max_aircraft);
+    traffic::TrafficResult* results =
+        state.scratch.allocate_array<traffic::TrafficResult>(traffic::max_aircraft);
+    char* buffer = state.scratch.allocate_array<char>(traffic_buffer_size);
+
+    char ship_line[max_line_length];
+    int32_t count = 0;
+    bool ok       = (token_count == 2) && utils::parse_int32(tokens[1], count) && count >= 1 &&
+              count <= traffic::max_aircraft;
+
+    if (states == nullptr || results == nullptr || buffer == nullptr)
+    {
+        print_error("scratch arena exhausted", state.sink);
+    }
+    else if (!ok)
+    {
+        print_error("traffic expects a ship count between 1 and 64", state.sink);
+    }
+    else
+    {
+        // One line per ship, ten values each (see TrafficState field order)
+        for (int32_t i = 0; ok && i < count; ++i)
+        {
+            const char* ship_tokens[max_tokens];
+            double values[max_tokens];
+
+            ok = state.read_line(state.read_context, ship_line, max_line_length);
+            if (ok)
+            {
+                int32_t ship_token_count = tokenize(ship_line, ship_tokens, max_tokens);
+                ok = (ship_token_count == 10);
+                for (int32_t v = 0; ok && v < 10; ++v)
+                {
+                    ok = utils::parse_double(ship_tokens[v], values[v]);
+                }
+            }
+            if (ok)
+            {
+                states[i].tas_kts           = values[0];
+                states[i].ias_kts           = values[1];
+                states[i].mach              = values[2];
+                states[i].altitude_ft       = values[3];
+                states[i].vs_fpm            = values[4];
+                states[i].bank_deg          = values[5];
+                states[i].course_change_deg = values[6];
+                states[i].vso_kts           = values[7];
+                states[i].vne_kts           = values[8];
+                states[i].mmo               = values[9];
+            }
+        }
+
+        if (!ok)
+        {
+            print_error("traffic expects one line of 10 numeric values per ship", state.sink);
+        }
+        else
+        {
+            state.engine.evaluate(states, count, results);
+            if (state.text_output)
+            {
+                print_traffic_json(results, count, buffer, traffic_buffer_size, state.sink);
+            }
+        }
+    }
+}
+
+// Read <count> constraint lines and re-solve the arrival descent profile.
+// The planner persists across requests, so a frame that only moves the
+// active leg's distance replans two legs instead of the whole arrival.
+void handle_vnavplan(const char** tokens,   // Header tokens ("vnavplan" <count> <alt> <gs>)
+                     int32_t token_count,   // Header token count
+                     DaemonState& state)
+{
+    char constraint_line[max_line_length];
+    calc::VNAVPlanner& planner = state.vnav_planner;
+    char* buffer               = state.scratch.allocate_array<char>(traffic_buffer_size);
+
+    int32_t count      = 0;
+    double current_alt = 0.0;
+    double groundspeed = 0.0;
+    bool ok = (token_count == 4) && utils::parse_int32(tokens[1], count) && count >= 1 &&
+              count <= calc::max_vnav_waypoints && utils::parse_double(tokens[2], current_alt) &&
+              utils::parse_double(tokens[3], groundspeed);
+
+    if (buffer == nullptr)
+    {
+        print_error("scratch arena exhausted", state.sink);
+    }
+    else if (!ok)
+    {
+        print_error("vnavplan expects a waypoint count between 1 and 32, altitude, groundspeed", state.sink);
+    }
+    else
+    {
+        planner.set_count(count);
+
+        // One line per waypoint: distance, altitude window, leg speed
+        for (int32_t i = 0; ok && i < count; ++i)
+        {
+            const char* wpt_tokens[max_tokens];
+            double values[max_tokens];
+
+            ok = state.read_line(state.read_context, constraint_line, max_line_length);
+            if (ok)
+            {
+                int32_t wpt_token_count = tokenize(constraint_line, wpt_tokens, max_tokens);
+                ok = (wpt_token_count == 4);
+                for (int32_t v = 0; ok && v < 4; ++v)
+                {
+                    ok = utils::parse_double(wpt_tokens[v], values[v]);
+                }
+            }
+            if (ok)
+            {
+                calc::VNAVConstraint constraint;
+                constraint.distance_nm = values[0];
+                constraint.alt_min_ft  = values[1];
+                constraint.alt_max_ft  = values[2];
+                constraint.speed_kts   = values[3];
+                planner.set_waypoint(i, constraint);
+            }
+        }
+
+        if (!ok)
+        {
+            print_error("vnavplan expects one line of 4 numeric values per waypoint", state.sink);
+        }
+        else
+        {
+            {
+                perf::ScopedTimer timer(state.perf.stage(perf::Stage::compute));
+                planner.plan(current_alt, groundspeed);
+            }
+
+            if (state.text_output)
+            {
+                perf::ScopedTimer timer(state.perf.stage(perf::Stage::serialize));
+
+                json::Writer writer(buffer, traffic_buffer_size);
+
+                writer.open_object();
+                writer.field("waypoint_count", planner.waypoint_count());
+                writer.field("tod_distance_nm", planner.tod_distance_nm());
+                writer.field_bool("descent_required", planner.descent_required());
+                writer.field("legs_replanned", planner.legs_replanned());
+                writer.open_array("target_alt_ft");
+                for (int32_t i = 0; i < planner.waypoint_count(); ++i)
+                {
+                    writer.item(planner.target_alt_ft(i));
+                }
+                writer.close_array();
+                writer.open_array("required_vs_fpm");
+                for (int32_t i = 0; i < planner.waypoint_count(); ++i)
+                {
+                    writer.item(planner.required_vs_fpm(i));
+                }
+                writer.close_array();
+                writer.open_array("path_angle_deg");
+                for (int32_t i = 0; i < planner.waypoint_count(); ++i)
+                {
+                    writer.item(planner.path_angle_deg(i));
+                }
+                writer.close_array();
+                writer.close_object();
+                fwrite(writer.data(), 1, writer.length(), state.sink);
+            }
+        }
+    }
+}
+
+// Glide ring sweep: wind from the air/ground vectors, then per-bearing
+// wind-adjusted range over the precomputed radial table
+void handle_ring(const double* args,        // tas, gs, heading, track, agl [, radials]
+                 int32_t arg_count,
+                 DaemonState& state)
+{
+    calc::GlideRing* ring = state.scratch.allocate_object<calc::GlideRing>();
+    char* buffer          = state.scratch.allocate_array<char>(traffic_buffer_size);
+
+    if (ring == nullptr || buffer == nullptr)
+    {
+        print_error("scratch arena exhausted", state.sink);
+    }
+    else
+    {
+        int32_t radials = calc::default_glide_radials;
+
+        if (arg_count == 6)
+        {
+            radials = static_cast<int32_t>(args[5]);
+        }
+        if (state.radial_table.count != radials)
+        {
+            calc::build_radial_table(radials, state.radial_table);
+        }
+
+        calc::WindData wind = calc::calculate_wind_vector(args[0], args[1], args[2], args[3], 0.0);
+        double glide_ratio  = calc::typical_glide_ratio;
+
+        {
+            perf::ScopedTimer timer(state.perf.stage(perf::Stage::compute));
+            calc::calculate_glide_ring(state.radial_table, args[4], args[0], wind, *ring, glide_ratio);
+        }
+
+        if (state.text_output)
+        {
+            perf::ScopedTimer timer(state.perf.stage(perf::Stage::serialize));
+
+            json::Writer writer(buffer, traffic_buffer_size);
+
+            writer.open_object();
+            writer.field("radial_count", ring->radial_count);
+            writer.field("step_deg", 360.0 / ring->radial_count);
+            writer.open_array("range_nm");
+            for (int32_t i = 0; i < ring->radial_count; ++i)
+            {
+                writer.item(ring->range_nm[i]);
+            }
+            writer.close_array();
+            writer.close_object();
+            fwrite(writer.data(), 1, writer.length(), state.sink);
+        }
+    }
+}
+
+// Turn trajectory polyline: TurnData first, then the arc-plus-rollout sweep
+void handle_arc(const double* args,        // tas, bank, course_change, heading [, points]
+                int32_t arg_count,
+                DaemonState& state)
+{
+    calc::TurnArc* arc = state.scratch.allocate_object<calc::TurnArc>();
+    char* buffer       = state.scratch.allocate_array<char>(traffic_buffer_size);
+
+    if (arc == nullptr || buffer == nullptr)
+    {
+        print_error("scratch arena exhausted", state.sink);
+    }
+    else
+    {
+        int32_t points = calc::default_arc_points;
+
+        if (arg_count == 5)
+        {
+            points = static_cast<int32_t>(args[4]);
+        }
+
+        {
+            perf::ScopedTimer timer(state.perf.stage(perf::Stage::compute));
+
+            calc::TurnData turn = (state.profile != nullptr)
+                                      ? state.profile->turn(args[0], args[1], args[2])
+                                      : calc::calculate_turn_performance(args[0], args[1], args[2]);
+            calc::calculate_turn_arc(turn, args[3], args[2], points, *arc);
+        }
+
+        if (state.text_output)
+        {
+            perf::ScopedTimer timer(state.perf.stage(perf::Stage::serialize));
+
+            json::Writer writer(buffer, traffic_buffer_size);
+
+            writer.open_object();
+            writer.field("point_count", arc->point_count);
+            writer.open_array("east_nm");
+            for (int32_t i = 0; i < arc->point_count; ++i)
+            {
+                writer.item(arc->east_nm[i]);
+            }
+            writer.close_array();
+            writer.open_array("north_nm");
+            for (int32_t i = 0; i < arc->point_count; ++i)
+            {
+                writer.item(arc->north_nm[i]);
+            }
+            writer.close_array();
+            writer.close_object();
+            fwrite(writer.data(), 1, writer.length(), state.sink);
+        }
+    }
+}
+
+// Shear across the query altitude from the banded wind history, plus the
+// running estimate for the query band itself when one exists
+void handle_shear(double altitude_ft,
+                  DaemonState& state)
+{
+    calc::WindShearData shear;
+    double band_speed_kts = 0.0;
+    double band_dir_from  = 0.0;
+    bool band_known       = false;
+
+    {
+        perf::ScopedTimer timer(state.perf.stage(perf::Stage::compute));
+        shear      = state.wind_history.shear(altitude_ft);
+        band_known = state.wind_history.estimate(altitude_ft, band_speed_kts, band_dir_from);
+    }
+
+    if (state.text_output)
+    {
+        perf::ScopedTimer timer(state.perf.stage(perf::Stage::serialize));
+
+        char buffer[json::default_buffer_size];
+        json::Writer writer(buffer, sizeof(buffer));
+
+        writer.open_object();
+        writer.field("altitude_ft", altitude_ft);
+        writer.field("occupied_bins", state.wind_history.occupied_bins());
+        writer.field_bool("band_known", band_known);
+        if (band_known)
+        {
+            writer.field("band_speed_kts", band_speed_kts);
+            writer.field("band_direction_from", band_dir_from);
+        }
+        writer.field_bool("shear_valid", shear.valid);
+        writer.field("shear_kts", shear.shear_kts);
+        writer.field("shear_per_1000ft", shear.shear_per_1000ft);
+        writer.field("span_ft", shear.span_ft);
+        writer.close_object();
+        fwrite(writer.data(), 1, writer.length(), state.sink);
+    }
+}
+
+// Emit the ready-made energy aggregates, one object per history tier
+void handle_energy(DaemonState& state)
+{
+    calc::EnergyTierStats tiers[calc::energy_tier_count];
+
+    {
+        perf::ScopedTimer timer(state.perf.stage(perf::Stage::compute));
+        for (int32_t i = 0; i < calc::energy_tier_count; ++i)
+        {
+            tiers[i] = state.energy_history.stats(i);
+        }
+    }
+
+    if (state.text_output)
+    {
+        perf::ScopedTimer timer(state.perf.stage(perf::Stage::serialize));
+
+        char buffer[json::default_buffer_size];
+        json::Writer writer(buffer, sizeof(buffer));
+
+        writer.open_object();
+        writer.open_array("tiers");
+        for (int32_t i = 0; i < calc::energy_tier_count; ++i)
+        {
+            writer.open_object();
+            writer.field("period_s", calc::energy_tier_period_s[i]);
+            writer.field("count", tiers[i].count);
+            writer.field_bool("valid", tiers[i].valid);
+            if (tiers[i].valid)
+            {
+                writer.field("min_ft", tiers[i].min_ft);
+                writer.field("max_ft", tiers[i].max_ft);
+                writer.field("mean_ft", tiers[i].mean_ft);
+                writer.field("slope_ft_per_s", tiers[i].slope_ft_per_s);
+            }
+            writer.close_object();
+        }
+        writer.close_array();
+        writer.close_object();
+        fwrite(writer.data(), 1, writer.length(), state.sink);
+    }
+}
+
+// Dump (and optionally reset) the per-stage latency histograms
+void handle_perf(const char** tokens,
+                 int32_t token_count,
+                 perf::StageSet& perf,
+                 FILE* out)          // Reply sink
+{
+    if (token_count == 2 && strcmp(tokens[1], "reset") == 0)
+    {
+        perf.reset();
+    }
+
+    static char buffer[json::default_buffer_size];
+    json::Writer writer(buffer, sizeof(buffer));
+
+    writer.open_object();
+    perf::append_perf_json(writer, perf);
+    writer.close_object();
+    fwrite(writer.data(), 1, writer.length(), out);
+}
+
+// Dispatch one request line; returns false when the client asked to quit
+bool dispatch(char* line,          // Request line (modified in place)
+              DaemonState& state)  // Daemon-lifetime state and options
+{
+    const char* tokens[max_tokens];
+    double args[max_tokens];
+    int32_t token_count = tokenize(line, tokens, max_tokens);
+    bool keep_running   = true;
+
+    // Whole-arena reset: every request starts with the full scratch space
+    state.scratch.reset();
+
+    shm::ExchangeFrame& frame            = state.frame;
+    const prof::ProfileKernels* profile  = state.profile;
+    bool text_output                     = state.text_output;
+    perf::Histogram& compute_histogram   = state.perf.stage(perf::Stage::compute);
+    perf::Histogram& serialize_histogram = state.perf.stage(perf::Stage::serialize);
+
+    if (token_count == 0)
+    {
+        // Ignore empty lines between frames
+    }
+    else if (strcmp(tokens[0], "quit") == 0)
+    {
+        keep_running = false;
+    }
+    else if (strcmp(tokens[0], "wind") == 0)
+    {
+        if (parse_args(tokens, token_count, args, 4))
+        {
+            calc::WindComponents comp;
+            {
+                perf::ScopedTimer timer(compute_histogram);
+                comp = calc::calculate_wind(args[0], args[1], args[2], args[3]);
+            }
+            if (text_output)
+            {
+                perf::ScopedTimer timer(serialize_histogram);
+                calc::print_json(comp, state.sink);
+            }
+
+            frame.in.track_deg      = args[0];
+            frame.in.heading_deg    = args[1];
+            frame.in.wind_dir_deg   = args[2];
+            frame.in.wind_speed_kts = args[3];
+            shm::store_wind_components(frame.out, comp);
+        }
+        else
+        {
+            print_error("wind expects 4 numeric arguments", state.sink);
+        }
+    }
+    else if (strcmp(tokens[0], "flight") == 0)
+    {
+        if (parse_args(tokens, token_count, args, 14))
+        {
+            calc::WindData wind;
+            calc::EnvelopeMargins envelope;
+            calc::EnergyData energy;
+            calc::GlideData glide;
+            {
+                perf::ScopedTimer timer(compute_histogram);
+
+                // The daemon sees every frame, so the gust window is fed from
+                // the live IAS stream instead of the CLI's synthetic readings
+                state.ias_buffer.add_reading(args[4]);
+
+                wind = calc::calculate_wind_vector(args[0], args[1], args[2], args[3],
+                                                   state.ias_buffer.gust_factor());
+                envelope =
+                    (profile != nullptr)
+                        ? profile->envelope(args[10], args[4], args[5], 0.0)
+                        : calc::calculate_envelope(args[10], args[4], args[5], args[11], args[12], args[13]);
+                energy = calc::calculate_energy(args[0], args[6], args[8]);
+                glide  = (profile != nullptr) ? profile->glide(args[7], args[0], wind.headwind)
+                                              : calc::calculate_glide_reach(args[7], args[0], wind.headwind);
+
+                // Remember this wind at this altitude for shear queries,
+                // and this energy state for the history tiers
+                state.wind_history.record(args[6], wind);
+                state.energy_history.record(energy);
+            }
+            if (text_output)
+            {
+                perf::ScopedTimer timer(serialize_histogram);
+                calc::print_json_results(wind, envelope, energy, glide, state.sink);
+            }
+
+            frame.in.tas_kts     = args[0];
+            frame.in.gs_kts      = args[1];
+            frame.in.heading_deg = args[2];
+            frame.in.track_deg   = args[3];
+            frame.in.ias_kts     = args[4];
+            frame.in.mach        = args[5];
+            frame.in.altitude_ft = args[6];
+            frame.in.agl_ft      = args[7];
+            frame.in.vs_fpm      = args[8];
+            frame.in.weight_kg   = args[9];
+            frame.in.bank_deg    = args[10];
+            frame.in.vso_kts     = args[11];
+            frame.in.vne_kts     = args[12];
+            frame.in.mmo         = args[13];
+            shm::store_wind_data(frame.out, wind);
+            shm::store_envelope(frame.out, envelope);
+            shm::store_energy(frame.out, energy);
+            shm::store_glide(frame.out, glide);
+        }
+        else
+        {
+            print_error("flight expects 14 numeric arguments", state.sink);
+        }
+    }
+    else if (strcmp(tokens[0], "turn") == 0)
+    {
+        if (parse_args(tokens, token_count, args, 3))
+        {
+            calc::TurnData turn;
+            {
+                perf::ScopedTimer timer(compute_histogram);
+                turn = (profile != nullptr) ? profile->turn(args[0], args[1], args[2])
+                                            : calc::calculate_turn_performance(args[0], args[1], args[2]);
+            }
+            if (text_output)
+            {
+                perf::ScopedTimer timer(serialize_histogram);
+                calc::print_json(turn, state.sink);
+            }
+
+            frame.in.tas_kts           = args[0];
+            frame.in.bank_deg          = args[1];
+            frame.in.course_change_deg = args[2];
+            shm::store_turn(frame.out, turn);
+        }
+        else
+        {
+            print_error("turn expects 3 numeric arguments", state.sink);
+        }
+    }
+    else if (strcmp(tokens[0], "vnav") == 0)
+    {
+        if (parse_args(tokens, token_count, args, 5))
+        {
+            calc::VNAVData vnav;
+            {
+                perf::ScopedTimer timer(compute_histogram);
+                vnav = calc::calculate_vnav(args[0], args[1], args[2], args[3], args[4]);
+            }
+            if (text_output)
+            {
+                perf::ScopedTimer timer(serialize_histogram);
+                calc::print_json(vnav, state.sink);
+            }
+
+            frame.in.altitude_ft   = args[0];
+            frame.in.target_alt_ft = args[1];
+            frame.in.distance_nm   = args[2];
+            frame.in.gs_kts        = args[3];
+            frame.in.vs_fpm        = args[4];
+            shm::store_vnav(frame.out, vnav);
+        }
+        else
+        {
+            print_error("vnav expects 5 numeric arguments", state.sink);
+        }
+    }
+    else if (strcmp(tokens[0], "vnavplan") == 0)
+    {
+        handle_vnavplan(tokens, token_count, state);
+    }
+    else if (strcmp(tokens[0], "traffic") == 0)
+    {
+        handle_traffic(tokens, token_count, state);
+    }
+    else if (strcmp(tokens[0], "ring") == 0)
+    {
+        if (parse_args(tokens, token_count, args, 5) || parse_args(tokens, token_count, args, 6))
+        {
+            handle_ring(args, token_count - 1, state);
+        }
+        else
+        {
+            print_error("ring expects 5 or 6 numeric arguments", state.sink);
+        }
+    }
+    else if (strcmp(tokens[0], "arc") == 0)
+    {
+        if (parse_args(tokens, token_count, args, 4) || parse_args(tokens, token_count, args, 5))
+        {
+            handle_arc(args, token_count - 1, state);
+        }
+        else
+        {
+            print_error("arc expects 4 or 5 numeric arguments", state.sink);
+        }
+    }
+    else if (strcmp(tokens[0], "shear") == 0)
+    {
+        if (parse_args(tokens, token_count, args, 1))
+        {
+            handle_shear(args[0], state);
+        }
+        else
+        {
+            print_error("shear expects 1 numeric argument", state.sink);
+        }
+    }
+    else if (strcmp(tokens[0], "energy") == 0)
+    {
+        handle_energy(state);
+    }
+    else if (strcmp(tokens[0], "perf") == 0)
+    {
+        handle_perf(tokens, token_count, state.perf, state.sink);
+    }
+    else if (strcmp(tokens[0], "density") == 0)
+    {
+        if (parse_args(tokens, token_count, args, 4))
+        {
+            calc::DensityAltitudeData da;
+            {
+                perf::ScopedTimer timer(compute_histogram);
+                da = calc::calculate_density_altitude_data(args[0], args[1], args[2], args[3]);
+            }
+            if (text_output)
+            {
+                perf::ScopedTimer timer(serialize_histogram);
+                calc::print_json(da, state.sink);
+            }
+
+            frame.in.pressure_alt_ft = args[0];
+            frame.in.oat_celsius     = args[1];
+            frame.in.ias_kts         = args[2];
+            frame.in.tas_kts         = args[3];
+            shm::store_density_altitude(frame.out, da);
+        }
+        else
+        {
+            print_error("density expects 4 numeric arguments", state.sink);
+        }
+    }
+    else
+    {
+        print_error("unknown command", state.sink);
+    }
+
+    if (token_count > 0 && keep_running)
+    {
+        {
+            perf::ScopedTimer timer(state.perf.stage(perf::Stage::publish));
+
+            if (state.shm_writer.is_open())
+            {
+                state.shm_writer.publish(frame);
+            }
+            if (state.mcast.is_open())
+            {
+                state.mcast.publish(frame);
+            }
+            if (state.recorder.is_open())
+            {
+                struct timespec now;
+                clock_gettime(CLOCK_REALTIME, &now);
+                state.recorder.append(
+                    static_cast<double>(now.tv_sec) + (static_cast<double>(now.tv_nsec) * 1.0e-9), frame);
+            }
+        }
+
+        // Frame terminator so the client knows the reply is complete
+        fprintf(state.sink, "\n");
+        fflush(state.sink);
+    }
+
+    return keep_running;
+}
+
+// Continuation-line source for the classic stdin pipe
+bool read_stdin_line(void* context,
+                     char* line,
+                     int32_t capacity)
+{
+    (void)context;
+    return static_cast<bool>(std::cin.getline(line, capacity));
+}
+
+// Continuation-line source in socket mode: the lines of a multi-line
+// request come from the same client's buffered frame
+bool read_client_line(void* context,
+                      char* line,
+                      int32_t capacity)
+{
+    return static_cast<net::EventServer*>(context)->continuation_line(line, capacity);
+}
+
+}  // namespace daemon
+}  // namespace airv
+
+int main(int argc,
+         char* argv[])
+{
+    char line[airv::daemon::max_line_length];
+    airv::daemon::DaemonState state;
+    const char* socket_path = nullptr;
+
+    // JSF: all threads exist before the request loop starts
+    if (!state.engine.start())
+    {
+        std::cerr << "Error: Cannot start traffic worker pool\n";
+        return static_cast<int>(airv::Return_code::invalid_value);
+    }
+
+    // Optional shared-memory publishing: --shm or --shm=/segment_name
+    // --format=binary suppresses JSON text entirely (clients read the segment)
+    for (int32_t i = 1; i < argc; ++i)
+    {
+        if (strcmp(argv[i], "--format=binary") == 0)
+        {
+            state.text_output = false;
+        }
+        else if (strncmp(argv[i], "--shm", 5) == 0)
+        {
+            const char* name = airv::shm::default_segment_name;
+            if (argv[i][5] == '=' && argv[i][6] != '\0')
+            {
+                name = &argv[i][6];
+            }
+            if (!state.shm_writer.open(name))
+            {
+                std::cerr << "Error: Cannot open shared-memory segment " << name << "\n";
+                return static_cast<int>(airv::Return_code::invalid_value);
+            }
+        }
+        else if (strncmp(argv[i], "--record=", 9) == 0)
+        {
+            if (!state.recorder.open(&argv[i][9]))
+            {
+                std::cerr << "Error: Cannot open recording " << &argv[i][9] << "\n";
+                return static_cast<int>(airv::Return_code::invalid_value);
+            }
+        }
+        else if (strncmp(argv[i], "--profile=", 10) == 0)
+        {
+            state.profile = airv::prof::find_profile(&argv[i][10]);
+            if (state.profile == nullptr)
+            {
+                std::cerr << "Error: Unknown aircraft profile " << &argv[i][10] << "\n";
+                return static_cast<int>(airv::Return_code::invalid_value);
+            }
+        }
+        else if (strncmp(argv[i], "--mcast", 7) == 0)
+        {
+            static char group_buffer[64];
+            const char* group = airv::net::default_multicast_group;
+            int32_t port      = static_cast<int32_t>(airv::net::default_multicast_port);
+
+            if (argv[i][7] == '=' && argv[i][8] != '\0')
+            {
+                strncpy(group_buffer, &argv[i][8], sizeof(group_buffer) - 1U);
+                group_buffer[sizeof(group_buffer) - 1U] = '\0';
+
+                char* colon = strchr(group_buffer, ':');
+                if (colon != nullptr)
+                {
+                    *colon = '\0';
+                    if (!airv::utils::parse_int32(&colon[1], port))
+                    {
+                        port = -1;
+                    }
+                }
+                group = group_buffer;
+            }
+            if (port < 1 || port > 65535 ||
+                !state.mcast.open(group, static_cast<uint16_t>(port)))
+            {
+                std::cerr << "Error: Cannot open multicast feed " << group << ":" << port << "\n";
+                return static_cast<int>(airv::Return_code::invalid_value);
+            }
+        }
+        else if (strncmp(argv[i], "--socket=", 9) == 0)
+        {
+            socket_path = &argv[i][9];
+        }
+    }
+
+    bool keep_running = true;
+
+    if (socket_path != nullptr)
+    {
+        // Multi-client socket mode: one epoll loop serves every display
+        // head; each reply is computed once and fanned out to all of them
+        static airv::net::EventServer server;
+        static char reply[airv::daemon::reply_buffer_bytes];
+
+        if (!server.open(socket_path))
+        {
+            std::cerr << "Error: Cannot open socket " << socket_path << "\n";
+            return static_cast<int>(airv::Return_code::invalid_value);
+        }
+
+        FILE* sink = fmemopen(reply, sizeof(reply), "w");
+        if (sink == nullptr)
+        {
+            std::cerr << "Error: Cannot create reply capture buffer\n";
+            return static_cast<int>(airv::Return_code::invalid_value);
+        }
+        state.sink         = sink;
+        state.read_line    = airv::daemon::read_client_line;
+        state.read_context = &server;
+
+        while (keep_running)
+        {
+            {
+                airv::perf::ScopedTimer timer(state.perf.stage(airv::perf::Stage::receive));
+                keep_running = server.poll(-1);
+            }
+            while (keep_running && server.next_line(line, airv::daemon::max_line_length))
+            {
+                rewind(sink);
+                keep_running = airv::daemon::dispatch(line, state);
+                fflush(sink);
+
+                long reply_length = ftell(sink);
+                if (reply_length > 0)
+                {
+                    server.broadcast(reply, static_cast<size_t>(reply_length));
+                }
+            }
+        }
+
+        fclose(sink);
+        server.close();
+    }
+    else
+    {
+        state.read_line = airv::daemon::read_stdin_line;
+
+        while (keep_running)
+        {
+            bool got_line = false;
+            {
+                airv::perf::ScopedTimer timer(state.perf.stage(airv::perf::Stage::receive));
+                got_line = static_cast<bool>(std::cin.getline(line, airv::daemon::max_line_length));
+            }
+            if (!got_line)
+            {
+                keep_running = false;
+            }
+            else
+            {
+                keep_running = airv::daemon::dispatch(line, state);
+            }
+        }
+    }
+
+    state.engine.stop();
+    state.recorder.close();
+
+    return static_cast<int>(airv::Return_code::success);
+}
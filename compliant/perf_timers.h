@@ -0,0 +1,212 @@
+// Hot-path instrumentation for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// Scoped timers around the pipeline stages (receive, compute, serialize,
+// publish) accumulated into fixed-size log2 latency histograms.  The
+// measured path is one timestamp read on entry, one on exit, and a handful
+// of integer operations to bump a bin — no allocation, no locking, no
+// formatting.  On x86-64 the timestamp source is RDTSC calibrated once
+// against the monotonic clock; elsewhere it is clock_gettime directly.
+// Histograms export on demand as a "perf" JSON section and reset at
+// runtime.
+
+#ifndef PERF_TIMERS
+#define PERF_TIMERS
+
+#include "json_writer.h"
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define AIRV_PERF_X86 1
+#include <x86intrin.h>
+#else
+#define AIRV_PERF_X86 0
+#endif
+
+namespace airv
+{
+namespace perf
+{
+
+// One bin per power of two of nanoseconds: bin 5 holds 32..63 ns samples
+constexpr int32_t histogram_bins = 32;
+
+// RDTSC calibration window against CLOCK_MONOTONIC
+constexpr int64_t calibration_window_ns = 2000000;
+
+inline uint64_t monotonic_ns()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (static_cast<uint64_t>(now.tv_sec) * 1000000000U) + static_cast<uint64_t>(now.tv_nsec);
+}
+
+#if AIRV_PERF_X86
+
+// Nanoseconds per TSC tick, measured once over a short spin on first use
+inline double ns_per_tick()
+{
+    static double result = []() {
+        uint64_t ns_start   = monotonic_ns();
+        uint64_t tick_start = __rdtsc();
+        uint64_t ns_end     = ns_start;
+
+        while (ns_end - ns_start < static_cast<uint64_t>(calibration_window_ns))
+        {
+            ns_end = monotonic_ns();
+        }
+
+        uint64_t tick_end = __rdtsc();
+        return static_cast<double>(ns_end - ns_start) / static_cast<double>(tick_end - tick_start);
+    }();
+
+    return result;
+}
+
+inline uint64_t timestamp() { return __rdtsc(); }
+
+inline uint64_t to_ns(uint64_t ticks) { return static_cast<uint64_t>(static_cast<double>(ticks) * ns_per_tick()); }
+
+#else
+
+inline uint64_t timestamp() { return monotonic_ns(); }
+
+inline uint64_t to_ns(uint64_t ticks) { return ticks; }
+
+#endif
+
+// Fixed-size log2 latency histogram; record() is branch-light and
+// allocation-free
+struct Histogram
+{
+    uint64_t counts[histogram_bins];
+    uint64_t total_ns;
+    uint64_t max_ns;
+    uint64_t samples;
+
+    Histogram() { reset(); }
+
+    void reset()
+    {
+        for (int32_t i = 0; i < histogram_bins; ++i)
+        {
+            counts[i] = 0;
+        }
+        total_ns = 0;
+        max_ns   = 0;
+        samples  = 0;
+    }
+
+    void record(uint64_t ns)
+    {
+        int32_t bin = (ns == 0) ? 0 : (63 - __builtin_clzll(ns));
+
+        if (bin >= histogram_bins)
+        {
+            bin = histogram_bins - 1;
+        }
+        ++counts[bin];
+        total_ns += ns;
+        if (ns > max_ns)
+        {
+            max_ns = ns;
+        }
+        ++samples;
+    }
+
+    double mean_ns() const { return (samples > 0) ? static_cast<double>(total_ns) / static_cast<double>(samples) : 0.0; }
+};
+
+// The instrumented pipeline stages, in frame order
+enum class Stage : int32_t
+{
+    receive   = 0,
+    compute   = 1,
+    serialize = 2,
+    publish   = 3,
+};
+
+constexpr int32_t stage_count = 4;
+
+inline const char* stage_name(int32_t stage)
+{
+    static const char* const names[stage_count] = {"receive", "compute", "serialize", "publish"};
+    return names[stage];
+}
+
+// One histogram per stage
+struct StageSet
+{
+    Histogram stages[stage_count];
+
+    Histogram& stage(Stage which) { return stages[static_cast<int32_t>(which)]; }
+
+    void reset()
+    {
+        for (int32_t i = 0; i < stage_count; ++i)
+        {
+            stages[i].reset();
+        }
+    }
+};
+
+// Times the enclosing scope into one histogram
+class ScopedTimer
+{
+public:
+    explicit ScopedTimer(Histogram& histogram)
+        : histogram_(histogram),
+          start_(timestamp())
+    {
+    }
+
+    ~ScopedTimer() { histogram_.record(to_ns(timestamp() - start_)); }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    Histogram& histogram_;
+    uint64_t start_;
+};
+
+// Append the "perf" section: per stage samples, mean/max, and the log2
+// bins up to the highest populated one
+inline void append_perf_json(json::Writer& writer,
+                             const StageSet& set)
+{
+    writer.open_object("perf");
+    for (int32_t i = 0; i < stage_count; ++i)
+    {
+        const Histogram& histogram = set.stages[i];
+        int32_t top_bin            = -1;
+
+        for (int32_t bin = 0; bin < histogram_bins; ++bin)
+        {
+            if (histogram.counts[bin] > 0)
+            {
+                top_bin = bin;
+            }
+        }
+
+        writer.open_object(stage_name(i));
+        writer.field("samples", histogram.samples);
+        writer.field("mean_ns", histogram.mean_ns());
+        writer.field("max_ns", histogram.max_ns);
+        writer.open_array("log2_ns_counts");
+        for (int32_t bin = 0; bin <= top_bin; ++bin)
+        {
+            writer.item(histogram.counts[bin]);
+        }
+        writer.close_array();
+        writer.close_object();
+    }
+    writer.close_object();
+}
+
+}  // namespace perf
+}  // namespace airv
+
+#endif  // !PERF_TIMERS
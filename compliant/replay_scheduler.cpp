@@ -0,0 +1,348 @@
+// Work-stealing parallel scheduler for batch telemetry replay
+// JSF AV C++ Coding Standard Compliant Version
+//
+// See replay_scheduler.h for the scheme.  A worker's range is one packed
+// 64-bit word {next, end}; the owner pops single chunks from the front
+// and thieves halve the range from the back, so both sides race through
+// the same compare-exchange and a chunk is claimed exactly once.
+
+#include "replay_scheduler.h"
+
+#include "simd_kernels.h"
+#include <cstring>
+
+namespace airv
+{
+namespace sched
+{
+
+namespace
+{
+
+// Range words pack the next claimable chunk and the one-past-end chunk
+inline uint64_t pack_range(int64_t next,
+                           int64_t end)
+{
+    return (static_cast<uint64_t>(next) << 32) | static_cast<uint64_t>(end);
+}
+
+inline int64_t range_next(uint64_t range)
+{
+    return static_cast<int64_t>(range >> 32);
+}
+
+inline int64_t range_end(uint64_t range)
+{
+    return static_cast<int64_t>(range & 0xFFFFFFFFU);
+}
+
+}  // namespace
+
+ReplayScheduler::ReplayScheduler()
+    : flight_count_(0),
+      total_chunks_(0),
+      worker_count_(0)
+{
+    for (int32_t i = 0; i < max_replay_flights; ++i)
+    {
+        flights_[i].reader      = nullptr;
+        flights_[i].output      = nullptr;
+        flights_[i].first_chunk = 0;
+        flights_[i].chunk_count = 0;
+    }
+    for (int32_t i = 0; i < max_replay_workers; ++i)
+    {
+        workers_[i].scheduler = this;
+        workers_[i].index     = i;
+        workers_[i].range.store(0, std::memory_order_relaxed);
+        workers_[i].steals = 0;
+    }
+}
+
+bool ReplayScheduler::add_flight(const rec::ReplayReader& reader,
+                                 batch::FlightResult* output)
+{
+    bool ok = (flight_count_ < max_replay_flights);
+
+    if (ok)
+    {
+        FlightTask& task = flights_[flight_count_];
+
+        task.reader      = &reader;
+        task.output      = output;
+        task.first_chunk = total_chunks_;
+        task.chunk_count = (reader.count() + replay_chunk_records - 1) / replay_chunk_records;
+
+        total_chunks_ += task.chunk_count;
+        ++flight_count_;
+    }
+
+    return ok;
+}
+
+bool ReplayScheduler::run(int32_t worker_count,
+                          ReplayStats& stats)
+{
+    if (worker_count < 1)
+    {
+        worker_count = 1;
+    }
+    if (worker_count > max_replay_workers)
+    {
+        worker_count = max_replay_workers;
+    }
+    worker_count_ = worker_count;
+
+    // Even initial shares of the global chunk list; imbalance between
+    // flights is what stealing corrects at runtime
+    for (int32_t w = 0; w < worker_count; ++w)
+    {
+        int64_t begin = (total_chunks_ * w) / worker_count;
+        int64_t end   = (total_chunks_ * (w + 1)) / worker_count;
+
+        workers_[w].steals = 0;
+        workers_[w].range.store(pack_range(begin, end), std::memory_order_relaxed);
+    }
+
+    pthread_t threads[max_replay_workers];
+    int32_t started = 0;
+    bool ok         = true;
+
+    for (int32_t w = 1; ok && w < worker_count; ++w)
+    {
+        ok = (pthread_create(&threads[w], nullptr, worker_main, &workers_[w]) == 0);
+        if (ok)
+        {
+            started = w;
+        }
+    }
+
+    // The calling thread is worker zero; even on a partial start the
+    // live workers drain every range before we report the failure
+    run_worker(workers_[0]);
+
+    for (int32_t w = 1; w <= started; ++w)
+    {
+        pthread_join(threads[w], nullptr);
+    }
+
+    stats.records = 0;
+    stats.steals  = 0;
+    stats.chunks  = total_chunks_;
+    stats.workers = worker_count;
+    for (int32_t i = 0; i < flight_count_; ++i)
+    {
+        stats.records += flights_[i].reader->count();
+    }
+    for (int32_t w = 0; w < worker_count; ++w)
+    {
+        stats.steals += workers_[w].steals;
+    }
+
+    return ok;
+}
+
+void* ReplayScheduler::worker_main(void* arg)
+{
+    Worker* worker = static_cast<Worker*>(arg);
+
+    worker->scheduler->run_worker(*worker);
+
+    return nullptr;
+}
+
+void ReplayScheduler::run_worker(Worker& worker)
+{
+    bool working = true;
+
+    while (working)
+    {
+        int64_t chunk = 0;
+
+        if (pop_local(worker, chunk))
+        {
+            process_chunk(worker, chunk);
+        }
+        else
+        {
+            // Own range drained: refill it from the busiest worker, or
+            // finish when every range is empty
+            working = steal(worker);
+        }
+    }
+}
+
+bool ReplayScheduler::pop_local(Worker& worker,
+                                int64_t& chunk)
+{
+    uint64_t current = worker.range.load(std::memory_order_acquire);
+    bool popped      = false;
+    bool retry       = true;
+
+    while (retry)
+    {
+        int64_t next = range_next(current);
+        int64_t end  = range_end(current);
+
+        if (next >= end)
+        {
+            retry = false;
+        }
+        else if (worker.range.compare_exchange_weak(current, pack_range(next + 1, end),
+                                                    std::memory_order_acq_rel))
+        {
+            chunk  = next;
+            popped = true;
+            retry  = false;
+        }
+    }
+
+    return popped;
+}
+
+bool ReplayScheduler::steal(Worker& worker)
+{
+    bool stolen = false;
+    bool retry  = true;
+
+    while (retry)
+    {
+        // Pick the victim with the most unclaimed chunks
+        int32_t victim     = -1;
+        int64_t victim_left = 0;
+        uint64_t victim_range = 0;
+
+        for (int32_t w = 0; w < worker_count_; ++w)
+        {
+            if (w != worker.index)
+            {
+                uint64_t range = workers_[w].range.load(std::memory_order_acquire);
+                int64_t left   = range_end(range) - range_next(range);
+
+                if (left > victim_left)
+                {
+                    victim       = w;
+                    victim_left  = left;
+                    victim_range = range;
+                }
+            }
+        }
+
+        if (victim < 0)
+        {
+            // Every other range is empty; any chunk still in flight is
+            // already claimed, so this worker is done
+            retry = false;
+        }
+        else
+        {
+            // Take the far half from the back so the owner keeps popping
+            // the front undisturbed
+            int64_t next = range_next(victim_range);
+            int64_t end  = range_end(victim_range);
+            int64_t take = (victim_left + 1) / 2;
+
+            if (workers_[victim].range.compare_exchange_strong(victim_range,
+                                                               pack_range(next, end - take),
+                                                               std::memory_order_acq_rel))
+            {
+                worker.range.store(pack_range(end - take, end), std::memory_order_release);
+                ++worker.steals;
+                stolen = true;
+                retry  = false;
+            }
+            // A lost race means the ranges moved; rescan and try again
+        }
+    }
+
+    return stolen;
+}
+
+void ReplayScheduler::process_chunk(Worker& worker,
+                                    int64_t global_chunk)
+{
+    // Map the global chunk id back to its flight
+    const FlightTask* task = nullptr;
+
+    for (int32_t i = 0; task == nullptr && i < flight_count_; ++i)
+    {
+        if (global_chunk >= flights_[i].first_chunk &&
+            global_chunk < flights_[i].first_chunk + flights_[i].chunk_count)
+        {
+            task = &flights_[i];
+        }
+    }
+    if (task == nullptr)
+    {
+        return;
+    }
+
+    const rec::ReplayReader& reader = *task->reader;
+    int64_t first_record            = (global_chunk - task->first_chunk) * replay_chunk_records;
+    int64_t count                   = reader.count() - first_record;
+
+    if (count > replay_chunk_records)
+    {
+        count = replay_chunk_records;
+    }
+
+    worker.arena.reset();
+
+    size_t n                       = static_cast<size_t>(count);
+    batch::Sample* samples         = worker.arena.allocate_array<batch::Sample>(n);
+    calc::WindData* winds          = worker.arena.allocate_array<calc::WindData>(n);
+    calc::EnvelopeMargins* margins = worker.arena.allocate_array<calc::EnvelopeMargins>(n);
+    calc::EnergyData* energies     = worker.arena.allocate_array<calc::EnergyData>(n);
+    calc::GlideData* glides        = worker.arena.allocate_array<calc::GlideData>(n);
+
+    if (samples == nullptr || winds == nullptr || margins == nullptr || energies == nullptr ||
+        glides == nullptr)
+    {
+        // Sized out by the static_assert in the header; cannot happen
+        return;
+    }
+
+    // EnergyData carries trailing padding after the trend enum; zero it
+    // so the bytes scattered into the output file are deterministic
+    memset(energies, 0, n * sizeof(calc::EnergyData));
+
+    // Replay the gust window from the records just before the chunk, so
+    // chunk boundaries do not perturb the rolling IAS statistics and the
+    // results match a sequential pass exactly
+    calc::SensorHistoryBuffer ias_buffer;
+    int64_t warm_first = first_record - static_cast<int64_t>(calc::max_ias_history);
+
+    if (warm_first < 0)
+    {
+        warm_first = 0;
+    }
+    for (int64_t i = warm_first; i < first_record; ++i)
+    {
+        ias_buffer.add_reading(reader.sample_at(i)->ias_kts);
+    }
+
+    // Gather the strided record inputs into one contiguous chunk the
+    // vectorized kernels can stream through
+    for (int64_t i = 0; i < count; ++i)
+    {
+        memcpy(&samples[i], reader.sample_at(first_record + i), sizeof(batch::Sample));
+    }
+
+    simd::calculate_wind_vector_batch(samples, n, winds, ias_buffer);
+    simd::calculate_envelope_batch(samples, n, margins);
+    batch::calculate_energy_batch(samples, n, energies);
+    batch::calculate_glide_reach_batch(samples, n, winds, glides);
+
+    batch::FlightResult* out = &task->output[first_record];
+
+    for (int64_t i = 0; i < count; ++i)
+    {
+        out[i].wind     = winds[i];
+        out[i].envelope = margins[i];
+        out[i].energy   = energies[i];
+        out[i].glide    = glides[i];
+    }
+}
+
+}  // namespace sched
+}  // namespace airv
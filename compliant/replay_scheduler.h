@@ -0,0 +1,124 @@
+// Work-stealing parallel scheduler for batch telemetry replay
+// JSF AV C++ Coding Standard Compliant Version
+//
+// Reprocesses multi-flight recording archives across every core.  Flights
+// differ in length by two orders of magnitude, so a static per-file split
+// leaves cores idle behind the longest flight; instead every flight's
+// memory-mapped record range is cut into batch-sized chunks, each worker
+// starts with an even share of the global chunk list, and a worker that
+// drains its share steals the far half of the largest remaining share.
+// Ranges live in one packed 64-bit atomic per worker, so owner pops and
+// thief steals are single compare-exchange operations with no locks.
+//
+// Each worker gathers its chunk from the mapping into a worker-local
+// arena (see fixed_alloc.h), replays the gust window from the records
+// just before the chunk, then runs the vectorized kernels over the
+// contiguous copy; results land directly in the caller-owned output
+// array at the chunk's offset.  Workers therefore share no mutable
+// state but the range atomics, and the output of a parallel run is
+// byte-identical to a sequential replay.
+
+#ifndef REPLAY_SCHEDULER
+#define REPLAY_SCHEDULER
+
+#include "batch_calc.h"
+#include "fixed_alloc.h"
+#include "flight_recorder.h"
+#include <atomic>
+#include <cstdint>
+#include <pthread.h>
+
+namespace airv
+{
+namespace sched
+{
+
+// Fixed limits: one archive, one pass
+constexpr int32_t max_replay_flights = 32;
+constexpr int32_t max_replay_workers = 16;
+
+// Records per work unit, matching the batch chunk the kernels like
+constexpr int64_t replay_chunk_records = static_cast<int64_t>(batch::chunk_size);
+
+// Per-worker scratch: the gathered sample chunk plus one array per kernel
+constexpr size_t chunk_scratch_bytes =
+    batch::chunk_size * (sizeof(batch::Sample) + sizeof(calc::WindData) + sizeof(calc::EnvelopeMargins) +
+                         sizeof(calc::EnergyData) + sizeof(calc::GlideData));
+constexpr size_t worker_arena_bytes = 512U * 1024U;
+
+static_assert(chunk_scratch_bytes + (8U * utils::arena_alignment) <= worker_arena_bytes,
+              "Worker arena must hold one chunk of samples and results");
+
+// Counters from one run, for the summary line
+struct ReplayStats
+{
+    int64_t records;  // Records processed across every flight
+    int64_t chunks;   // Work units executed
+    int64_t steals;   // Range halves taken from other workers
+    int32_t workers;  // Threads that ran, including the caller
+};
+
+// One scheduled run over an archive of open recordings
+class ReplayScheduler
+{
+public:
+    ReplayScheduler();
+
+    // Register one flight; output must hold reader.count() results.
+    // Returns false when the flight table is full.
+    bool add_flight(const rec::ReplayReader& reader,
+                    batch::FlightResult* output);
+
+    // Process every registered flight across worker_count threads
+    // (clamped to [1, max_replay_workers]); the calling thread is worker
+    // zero.  Blocks until the archive is done; returns false if a helper
+    // thread fails to start.
+    bool run(int32_t worker_count,
+             ReplayStats& stats);
+
+private:
+    // One flight's slice of the global chunk index space
+    struct FlightTask
+    {
+        const rec::ReplayReader* reader;
+        batch::FlightResult* output;
+        int64_t first_chunk;  // Global index of the flight's chunk zero
+        int64_t chunk_count;
+    };
+
+    // Everything one worker touches; ranges are the only shared words
+    struct Worker
+    {
+        ReplayScheduler* scheduler;
+        int32_t index;
+        std::atomic<uint64_t> range;  // Packed {next, end} global chunk ids
+        int64_t steals;               // Successful steals by this worker
+        utils::Arena<worker_arena_bytes> arena;
+    };
+
+    static void* worker_main(void* arg);
+
+    void run_worker(Worker& worker);
+
+    // Owner side: claim the front chunk of the worker's own range
+    bool pop_local(Worker& worker,
+                   int64_t& chunk);
+
+    // Thief side: move the far half of the largest other range into the
+    // worker's own (empty) range
+    bool steal(Worker& worker);
+
+    void process_chunk(Worker& worker,
+                       int64_t global_chunk);
+
+    FlightTask flights_[max_replay_flights];
+    int32_t flight_count_;
+    int64_t total_chunks_;
+    int32_t worker_count_;
+    Worker workers_[max_replay_workers];
+};
+
+}  // namespace sched
+}  // namespace airv
+
+#endif  // !REPLAY_SCHEDULER
@@ -0,0 +1,142 @@
+// Seqlock result snapshots for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// Lock-free publication of computed results to display readers.  Writers
+// bump a sequence counter to an odd value, copy the payload, then bump it
+// even again; a reader that observes an odd or changed sequence retries
+// instead of blocking, so a slow or stalled display can never hold up the
+// compute loop.  Fixed-size storage, no allocation, no mutexes — writers
+// are wait-free.  (The shared-memory exchange in shm_exchange.h uses the
+// same protocol across processes; this is the in-process counterpart for
+// the daemon and the multi-aircraft engine.)
+
+#ifndef SEQLOCK_SNAPSHOT
+#define SEQLOCK_SNAPSHOT
+
+#include "density_altitude_calc.h"
+#include "flight_calc.h"
+#include "turn_calc.h"
+#include "vnav_calc.h"
+#include <atomic>
+#include <cstdint>
+
+namespace airv
+{
+namespace snap
+{
+
+// One slot per possible aircraft (own ship plus AI traffic)
+constexpr int32_t max_slots = 64;
+
+// Bounded retries before a reader gives up on a torn read
+constexpr int32_t default_read_retries = 8;
+
+// Every calculator result for one aircraft; sections the producer does not
+// compute stay zero-initialized
+struct CalcSnapshot
+{
+    calc::WindData wind;
+    calc::EnvelopeMargins envelope;
+    calc::EnergyData energy;
+    calc::GlideData glide;
+    calc::TurnData turn;
+    calc::VNAVData vnav;
+    calc::DensityAltitudeData density_altitude;
+};
+
+// Single-writer seqlock over one payload
+template<typename T>
+class Seqlock
+{
+public:
+    Seqlock()
+        : sequence_(0U)
+    {
+    }
+
+    // Wait-free: never observes readers, never retries
+    void publish(const T& value)
+    {
+        uint32_t sequence = sequence_.load(std::memory_order_relaxed);
+
+        sequence_.store(sequence + 1U, std::memory_order_relaxed);  // Odd: write in progress
+        std::atomic_thread_fence(std::memory_order_release);
+        payload_ = value;
+        std::atomic_thread_fence(std::memory_order_release);
+        sequence_.store(sequence + 2U, std::memory_order_release);
+    }
+
+    // One attempt; false when a write overlapped the copy
+    bool try_read(T& out) const
+    {
+        uint32_t before = sequence_.load(std::memory_order_acquire);
+        bool ok         = ((before & 1U) == 0U);
+
+        if (ok)
+        {
+            out = payload_;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            ok = (sequence_.load(std::memory_order_relaxed) == before);
+        }
+
+        return ok;
+    }
+
+    // Retry a bounded number of times; false only under sustained contention
+    bool read(T& out,
+              int32_t max_retries = default_read_retries) const
+    {
+        bool ok = false;
+
+        for (int32_t attempt = 0; !ok && attempt < max_retries; ++attempt)
+        {
+            ok = try_read(out);
+        }
+
+        return ok;
+    }
+
+private:
+    std::atomic<uint32_t> sequence_;
+    T payload_;
+};
+
+// Per-aircraft snapshot slots; each slot has one writer (the lane that
+// computed the ship) and any number of readers
+class SnapshotTable
+{
+public:
+    SnapshotTable()
+        : count_(0)
+    {
+    }
+
+    void publish(int32_t slot,
+                 const CalcSnapshot& snapshot)
+    {
+        if (slot >= 0 && slot < max_slots)
+        {
+            slots_[slot].publish(snapshot);
+        }
+    }
+
+    bool read(int32_t slot,
+              CalcSnapshot& out) const
+    {
+        return (slot >= 0 && slot < max_slots) && slots_[slot].read(out);
+    }
+
+    // Ship count of the latest frame (set once the frame is complete)
+    void set_count(int32_t count) { count_.store(count, std::memory_order_release); }
+
+    int32_t count() const { return count_.load(std::memory_order_acquire); }
+
+private:
+    Seqlock<CalcSnapshot> slots_[max_slots];
+    std::atomic<int32_t> count_;
+};
+
+}  // namespace snap
+}  // namespace airv
+
+#endif  // !SEQLOCK_SNAPSHOT
@@ -0,0 +1,340 @@
+// Shared-memory dataref exchange for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// Binary exchange segment between mfd_calcd and the display client.  The
+// segment holds a versioned, fixed-layout frame of every input dataref and
+// every calculator output field, double-buffered with per-buffer sequence
+// counters so the reader never sees a torn frame and never parses text:
+//
+//   writer: pick the inactive buffer, bump its sequence (odd = in flight),
+//           copy the frame, bump again (even = stable), flip active_index
+//   reader: read active_index, copy that buffer, confirm its sequence is
+//           even and unchanged, otherwise retry
+//
+// All payload fields are IEEE-754 doubles in declaration order, so the
+// Python side can unpack the whole frame with one struct.unpack call.
+
+#ifndef SHM_EXCHANGE
+#define SHM_EXCHANGE
+
+#include "density_altitude_calc.h"
+#include "flight_calc.h"
+#include "turn_calc.h"
+#include "vnav_calc.h"
+#include "wind_calc.h"
+#include "xplane_mfd_calc.h"
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace airv
+{
+namespace shm
+{
+
+// Layout identification
+constexpr uint32_t exchange_magic   = 0x4D464431;  // "MFD1" little-endian
+constexpr uint32_t exchange_version = 1;
+
+// Default POSIX shm object name
+constexpr char default_segment_name[] = "/xplane_mfd_calc";
+
+// All input datarefs the calculators consume, one frame per display tick
+struct InputFrame
+{
+    double tas_kts;            // True airspeed (knots)
+    double gs_kts;             // Ground speed (knots)
+    double heading_deg;        // Heading (deg)
+    double track_deg;          // Ground track (deg)
+    double ias_kts;            // Indicated airspeed (knots)
+    double mach;               // Mach number
+    double altitude_ft;        // Altitude (feet)
+    double agl_ft;             // Above ground level (feet)
+    double vs_fpm;             // Vertical speed (feet/min)
+    double weight_kg;          // Aircraft weight (kg)
+    double bank_deg;           // Bank angle (deg)
+    double vso_kts;            // Stall speed in landing config (knots IAS)
+    double vne_kts;            // Velocity never exceed (knots IAS)
+    double mmo;                // Maximum operating Mach number
+    double wind_dir_deg;       // Wind direction FROM (degrees)
+    double wind_speed_kts;     // Wind speed (knots)
+    double target_alt_ft;      // VNAV target altitude (feet)
+    double distance_nm;        // Distance to constraint (nautical miles)
+    double course_change_deg;  // Course change for turn lead (degrees)
+    double pressure_alt_ft;    // Pressure altitude (feet)
+    double oat_celsius;        // Outside air temperature (Celsius)
+};
+
+// Every calculator output field, flattened to doubles (enums and flags are
+// stored as 0.0/1.0/-1.0 so the reader needs no per-field type handling)
+struct OutputFrame
+{
+    // WindData (flight_calc.h)
+    double wind_speed_kts;
+    double wind_direction_from;
+    double wind_headwind;
+    double wind_crosswind;
+    double wind_gust_factor;
+
+    // WindComponents (wind_calc.h)
+    double comp_headwind;
+    double comp_crosswind;
+    double comp_total_wind;
+    double comp_wca;
+    double comp_drift;
+
+    // EnvelopeMargins
+    double stall_margin_pct;
+    double vmo_margin_pct;
+    double mmo_margin_pct;
+    double min_margin_pct;
+    double load_factor;
+    double corner_speed_kts;
+
+    // EnergyData
+    double specific_energy_ft;
+    double energy_rate_kts;
+    double energy_trend;  // -1.0 / 0.0 / 1.0
+
+    // GlideData
+    double still_air_range_nm;
+    double wind_adjusted_range_nm;
+    double glide_ratio;
+    double best_glide_speed_kts;
+
+    // TurnData
+    double turn_radius_nm;
+    double turn_radius_ft;
+    double turn_rate_dps;
+    double lead_distance_nm;
+    double lead_distance_ft;
+    double time_to_turn_sec;
+    double turn_load_factor;
+    double standard_rate_bank;
+
+    // VNAVData
+    double altitude_to_lose_ft;
+    double flight_path_angle_deg;
+    double required_vs_fpm;
+    double tod_distance_nm;
+    double time_to_constraint_min;
+    double distance_per_1000ft;
+    double vs_for_3deg;
+    double is_descent;  // 0.0 / 1.0
+
+    // DensityAltitudeData
+    double density_altitude_ft;
+    double pressure_altitude_ft;
+    double air_density_ratio;
+    double temperature_deviation_c;
+    double performance_loss_pct;
+    double eas_kts;
+    double tas_to_ias_ratio;
+    double pressure_ratio;
+};
+
+// One double-buffered slot: everything the display needs for a tick
+struct ExchangeFrame
+{
+    InputFrame in;
+    OutputFrame out;
+};
+
+struct ExchangeSegment
+{
+    uint32_t magic;          // exchange_magic
+    uint32_t version;        // exchange_version, bump on any layout change
+    uint32_t frame_bytes;    // sizeof(ExchangeFrame), layout cross-check
+    uint32_t active_index;   // Which of frames[] holds the latest stable data
+    uint32_t sequence[2];    // Per-buffer counters, odd while being written
+    uint32_t reserved[2];    // Keeps frames[] 8-byte aligned, future use
+    ExchangeFrame frames[2];
+};
+
+// The Python reader unpacks frames as a run of doubles; padding would break it
+static_assert(sizeof(InputFrame) == 21 * sizeof(double), "InputFrame must stay packed");
+static_assert(sizeof(OutputFrame) == 47 * sizeof(double), "OutputFrame must stay packed");
+static_assert(sizeof(ExchangeFrame) == sizeof(InputFrame) + sizeof(OutputFrame), "ExchangeFrame must stay packed");
+
+// Writer side of the exchange, used by mfd_calcd
+class ExchangeWriter
+{
+public:
+    ExchangeWriter()
+        : segment_(nullptr),
+          fd_(-1)
+    {
+    }
+
+    ~ExchangeWriter() { close(); }
+
+    // Create (or reopen) the segment; returns false if the OS refuses
+    bool open(const char* name)
+    {
+        fd_ = shm_open(name, O_CREAT | O_RDWR, 0600);
+        if (fd_ < 0)
+        {
+            return false;
+        }
+        if (ftruncate(fd_, static_cast<off_t>(sizeof(ExchangeSegment))) != 0)
+        {
+            close();
+            return false;
+        }
+        void* mapped = mmap(nullptr, sizeof(ExchangeSegment), PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (mapped == MAP_FAILED)
+        {
+            close();
+            return false;
+        }
+        segment_ = static_cast<ExchangeSegment*>(mapped);
+
+        segment_->magic        = exchange_magic;
+        segment_->version      = exchange_version;
+        segment_->frame_bytes  = static_cast<uint32_t>(sizeof(ExchangeFrame));
+        segment_->active_index = 0;
+        segment_->sequence[0]  = 0;
+        segment_->sequence[1]  = 0;
+        segment_->reserved[0]  = 0;
+        segment_->reserved[1]  = 0;
+        std::atomic_thread_fence(std::memory_order_release);
+        return true;
+    }
+
+    bool is_open() const { return segment_ != nullptr; }
+
+    // Publish one frame into the inactive buffer and flip
+    void publish(const ExchangeFrame& frame)
+    {
+        if (segment_ == nullptr)
+        {
+            return;
+        }
+        uint32_t idx = 1U - segment_->active_index;
+
+        segment_->sequence[idx] += 1U;  // Odd: buffer in flight
+        std::atomic_thread_fence(std::memory_order_release);
+
+        memcpy(&segment_->frames[idx], &frame, sizeof(ExchangeFrame));
+
+        std::atomic_thread_fence(std::memory_order_release);
+        segment_->sequence[idx] += 1U;  // Even: buffer stable
+        segment_->active_index = idx;
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    void close()
+    {
+        if (segment_ != nullptr)
+        {
+            munmap(segment_, sizeof(ExchangeSegment));
+            segment_ = nullptr;
+        }
+        if (fd_ >= 0)
+        {
+            ::close(fd_);
+            fd_ = -1;
+        }
+    }
+
+private:
+    ExchangeSegment* segment_;
+    int fd_;
+};
+
+// Fill helpers so the daemon does not hand-copy fields at every call site
+inline void store_wind_data(OutputFrame& out,
+                            const calc::WindData& wind)
+{
+    out.wind_speed_kts      = wind.speed_kts;
+    out.wind_direction_from = wind.direction_from;
+    out.wind_headwind       = wind.headwind;
+    out.wind_crosswind      = wind.crosswind;
+    out.wind_gust_factor    = wind.gust_factor;
+}
+
+inline void store_wind_components(OutputFrame& out,
+                                  const calc::WindComponents& comp)
+{
+    out.comp_headwind   = comp.headwind;
+    out.comp_crosswind  = comp.crosswind;
+    out.comp_total_wind = comp.total_wind;
+    out.comp_wca        = comp.wca;
+    out.comp_drift      = comp.drift;
+}
+
+inline void store_envelope(OutputFrame& out,
+                           const calc::EnvelopeMargins& envelope)
+{
+    out.stall_margin_pct = envelope.stall_margin_pct;
+    out.vmo_margin_pct   = envelope.vmo_margin_pct;
+    out.mmo_margin_pct   = envelope.mmo_margin_pct;
+    out.min_margin_pct   = envelope.min_margin_pct;
+    out.load_factor      = envelope.load_factor;
+    out.corner_speed_kts = envelope.corner_speed_kts;
+}
+
+inline void store_energy(OutputFrame& out,
+                         const calc::EnergyData& energy)
+{
+    out.specific_energy_ft = energy.specific_energy_ft;
+    out.energy_rate_kts    = energy.energy_rate_kts;
+    out.energy_trend       = static_cast<double>(static_cast<int32_t>(energy.trend));
+}
+
+inline void store_glide(OutputFrame& out,
+                        const calc::GlideData& glide)
+{
+    out.still_air_range_nm     = glide.still_air_range_nm;
+    out.wind_adjusted_range_nm = glide.wind_adjusted_range_nm;
+    out.glide_ratio            = glide.glide_ratio;
+    out.best_glide_speed_kts   = glide.best_glide_speed_kts;
+}
+
+inline void store_turn(OutputFrame& out,
+                       const calc::TurnData& turn)
+{
+    out.turn_radius_nm     = turn.radius_nm;
+    out.turn_radius_ft     = turn.radius_ft;
+    out.turn_rate_dps      = turn.turn_rate_dps;
+    out.lead_distance_nm   = turn.lead_distance_nm;
+    out.lead_distance_ft   = turn.lead_distance_ft;
+    out.time_to_turn_sec   = turn.time_to_turn_sec;
+    out.turn_load_factor   = turn.load_factor;
+    out.standard_rate_bank = turn.standard_rate_bank;
+}
+
+inline void store_vnav(OutputFrame& out,
+                       const calc::VNAVData& vnav)
+{
+    out.altitude_to_lose_ft    = vnav.altitude_to_lose_ft;
+    out.flight_path_angle_deg  = vnav.flight_path_angle_deg;
+    out.required_vs_fpm        = vnav.required_vs_fpm;
+    out.tod_distance_nm        = vnav.tod_distance_nm;
+    out.time_to_constraint_min = vnav.time_to_constraint_min;
+    out.distance_per_1000ft    = vnav.distance_per_1000ft;
+    out.vs_for_3deg            = vnav.vs_for_3deg;
+    out.is_descent             = vnav.is_descent ? 1.0 : 0.0;
+}
+
+inline void store_density_altitude(OutputFrame& out,
+                                   const calc::DensityAltitudeData& da)
+{
+    out.density_altitude_ft     = da.density_altitude_ft;
+    out.pressure_altitude_ft    = da.pressure_altitude_ft;
+    out.air_density_ratio       = da.air_density_ratio;
+    out.temperature_deviation_c = da.temperature_deviation_c;
+    out.performance_loss_pct    = da.performance_loss_pct;
+    out.eas_kts                 = da.eas_kts;
+    out.tas_to_ias_ratio        = da.tas_to_ias_ratio;
+    out.pressure_ratio          = da.pressure_ratio;
+}
+
+}  // namespace shm
+}  // namespace airv
+
+#endif  // !SHM_EXCHANGE
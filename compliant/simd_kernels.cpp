@@ -0,0 +1,423 @@
+// SIMD-vectorized calculation kernels for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// AVX2+FMA implementations of the wind vector and envelope kernels.  The
+// vector functions carry a target attribute so this file still compiles with
+// the project's generic flags; dispatch happens once per call through
+// __builtin_cpu_supports.  Scalar tails and non-AVX2 machines use the
+// reference loops from batch_calc.h.
+
+#include "simd_kernels.h"
+#include "batch_calc.h"
+#include "batch_soa.h"
+#include "flight_calc.h"
+#include "xplane_mfd_calc.h"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define AIRV_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define AIRV_SIMD_X86 0
+#endif
+
+namespace airv
+{
+namespace simd
+{
+
+bool avx2_available(void)
+{
+#if AIRV_SIMD_X86
+    return __builtin_cpu_supports("avx2") != 0 && __builtin_cpu_supports("fma") != 0;
+#else
+    return false;
+#endif
+}
+
+#if AIRV_SIMD_X86
+
+namespace
+{
+
+constexpr int simd_width = 4;  // doubles per AVX2 register
+
+// fdlibm __kernel_sin minimax coefficients, |r| <= pi/2
+constexpr double sin_c1 = -1.66666666666666657415e-1;
+constexpr double sin_c2 = 8.33333333333331805e-3;
+constexpr double sin_c3 = -1.98412698412341642e-4;
+constexpr double sin_c4 = 2.75573192239858925e-6;
+constexpr double sin_c5 = -2.50521083854417187e-8;
+constexpr double sin_c6 = 1.60590438368216146e-10;
+constexpr double sin_c7 = -7.64712219118158833e-13;
+
+// Two-part pi for accurate argument reduction
+constexpr double pi_hi = 3.141592653589793116;
+constexpr double pi_lo = 1.224646799147353207e-16;
+
+constexpr double quarter_pi   = 0.785398163397448309615660845;
+constexpr double atan_break   = 0.414213562373095048801688724;  // tan(pi/8)
+constexpr double pi_over_two  = 1.570796326794896619231321692;
+
+__attribute__((target("avx2,fma"))) inline __m256d v_abs(__m256d x)
+{
+    return _mm256_andnot_pd(_mm256_set1_pd(-0.0), x);
+}
+
+// sin(x) for arbitrary x: reduce by pi, odd quadrants flip the sign
+__attribute__((target("avx2,fma"))) __m256d v_sin(__m256d x)
+{
+    __m256d inv_pi = _mm256_set1_pd(1.0 / pi_hi);
+    __m256d q      = _mm256_round_pd(_mm256_mul_pd(x, inv_pi), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+
+    __m256d r = _mm256_fnmadd_pd(q, _mm256_set1_pd(pi_hi), x);
+    r         = _mm256_fnmadd_pd(q, _mm256_set1_pd(pi_lo), r);
+
+    __m256d s    = _mm256_mul_pd(r, r);
+    __m256d poly = _mm256_set1_pd(sin_c7);
+    poly         = _mm256_fmadd_pd(poly, s, _mm256_set1_pd(sin_c6));
+    poly         = _mm256_fmadd_pd(poly, s, _mm256_set1_pd(sin_c5));
+    poly         = _mm256_fmadd_pd(poly, s, _mm256_set1_pd(sin_c4));
+    poly         = _mm256_fmadd_pd(poly, s, _mm256_set1_pd(sin_c3));
+    poly         = _mm256_fmadd_pd(poly, s, _mm256_set1_pd(sin_c2));
+    poly         = _mm256_fmadd_pd(poly, s, _mm256_set1_pd(sin_c1));
+    __m256d sinr = _mm256_fmadd_pd(_mm256_mul_pd(poly, s), r, r);
+
+    // Odd multiples of pi flip the sign; parity of q via q/2 - floor(q/2)
+    __m256d half      = _mm256_set1_pd(0.5);
+    __m256d q_half    = _mm256_mul_pd(q, half);
+    __m256d q_half_fl = _mm256_round_pd(q_half, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+    __m256d odd       = _mm256_sub_pd(q_half, q_half_fl);  // 0.0 for even q, 0.5 for odd q
+    __m256d flip      = _mm256_cmp_pd(odd, _mm256_set1_pd(0.25), _CMP_GT_OQ);
+    __m256d negated   = _mm256_sub_pd(_mm256_setzero_pd(), sinr);
+
+    return _mm256_blendv_pd(sinr, negated, flip);
+}
+
+__attribute__((target("avx2,fma"))) __m256d v_cos(__m256d x)
+{
+    return v_sin(_mm256_add_pd(x, _mm256_set1_pd(pi_over_two)));
+}
+
+// atan on [0, 1] via the pi/8 split, odd polynomial in t
+__attribute__((target("avx2,fma"))) __m256d v_atan01(__m256d r)
+{
+    __m256d one    = _mm256_set1_pd(1.0);
+    __m256d use_hi = _mm256_cmp_pd(r, _mm256_set1_pd(atan_break), _CMP_GT_OQ);
+
+    // t = (r - 1) / (r + 1) maps (tan(pi/8), 1] onto (-tan(pi/8), 0]
+    __m256d t_hi = _mm256_div_pd(_mm256_sub_pd(r, one), _mm256_add_pd(r, one));
+    __m256d t    = _mm256_blendv_pd(r, t_hi, use_hi);
+
+    __m256d s    = _mm256_mul_pd(t, t);
+    __m256d poly = _mm256_set1_pd(1.0 / 13.0);
+    poly         = _mm256_fnmadd_pd(poly, s, _mm256_set1_pd(1.0 / 11.0));
+    poly         = _mm256_fnmadd_pd(poly, s, _mm256_set1_pd(1.0 / 9.0));
+    poly         = _mm256_fnmadd_pd(poly, s, _mm256_set1_pd(1.0 / 7.0));
+    poly         = _mm256_fnmadd_pd(poly, s, _mm256_set1_pd(1.0 / 5.0));
+    poly         = _mm256_fnmadd_pd(poly, s, _mm256_set1_pd(1.0 / 3.0));
+    __m256d a    = _mm256_fnmadd_pd(_mm256_mul_pd(poly, s), t, t);
+
+    __m256d a_hi = _mm256_add_pd(a, _mm256_set1_pd(quarter_pi));
+    return _mm256_blendv_pd(a, a_hi, use_hi);
+}
+
+// Full four-quadrant atan2
+__attribute__((target("avx2,fma"))) __m256d v_atan2(__m256d y,
+                                                    __m256d x)
+{
+    __m256d ax = v_abs(x);
+    __m256d ay = v_abs(y);
+
+    __m256d hi = _mm256_max_pd(ax, ay);
+    __m256d lo = _mm256_min_pd(ax, ay);
+    __m256d r  = _mm256_div_pd(lo, hi);  // in [0, 1]
+
+    __m256d a = v_atan01(r);
+
+    // Zero-motion samples make the division 0/0 = NaN; the scalar
+    // reference defines atan2(0, 0) as 0, so force those lanes to zero
+    __m256d both_zero = _mm256_cmp_pd(hi, _mm256_setzero_pd(), _CMP_EQ_OQ);
+    a                 = _mm256_andnot_pd(both_zero, a);
+
+    // |y| > |x|: angle measured from the y axis instead
+    __m256d swap = _mm256_cmp_pd(ay, ax, _CMP_GT_OQ);
+    a            = _mm256_blendv_pd(a, _mm256_sub_pd(_mm256_set1_pd(pi_over_two), a), swap);
+
+    // x < 0: reflect into the second/third quadrant
+    __m256d x_neg = _mm256_cmp_pd(x, _mm256_setzero_pd(), _CMP_LT_OQ);
+    a             = _mm256_blendv_pd(a, _mm256_sub_pd(_mm256_set1_pd(pi_hi), a), x_neg);
+
+    // Take the sign of y
+    __m256d y_sign = _mm256_and_pd(y, _mm256_set1_pd(-0.0));
+    return _mm256_or_pd(a, y_sign);
+}
+
+// Wrap a degree delta into (-180, 180]
+__attribute__((target("avx2,fma"))) __m256d v_wrap_half_circle(__m256d deg)
+{
+    __m256d wrap = _mm256_set1_pd(units::angle_wrap);
+    __m256d q    = _mm256_round_pd(_mm256_div_pd(deg, wrap), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    return _mm256_fnmadd_pd(q, wrap, deg);
+}
+
+// Trig block of calculate_wind_vector for four samples at once
+__attribute__((target("avx2,fma"))) void wind_vector_lanes(const batch::Sample* samples,  // >= 4 samples
+                                                           calc::WindData* results)       // 4 results
+{
+    __m256d tas     = _mm256_set_pd(samples[3].tas_kts, samples[2].tas_kts, samples[1].tas_kts, samples[0].tas_kts);
+    __m256d gs      = _mm256_set_pd(samples[3].gs_kts, samples[2].gs_kts, samples[1].gs_kts, samples[0].gs_kts);
+    __m256d heading = _mm256_set_pd(
+        samples[3].heading_deg, samples[2].heading_deg, samples[1].heading_deg, samples[0].heading_deg);
+    __m256d track =
+        _mm256_set_pd(samples[3].track_deg, samples[2].track_deg, samples[1].track_deg, samples[0].track_deg);
+
+    __m256d deg_to_rad = _mm256_set1_pd(units::deg_to_rad);
+    __m256d h_rad      = _mm256_mul_pd(heading, deg_to_rad);
+    __m256d t_rad      = _mm256_mul_pd(track, deg_to_rad);
+
+    // Wind = Ground - Air, component-wise
+    __m256d wx = _mm256_fnmadd_pd(tas, v_sin(h_rad), _mm256_mul_pd(gs, v_sin(t_rad)));
+    __m256d wy = _mm256_fnmadd_pd(tas, v_cos(h_rad), _mm256_mul_pd(gs, v_cos(t_rad)));
+
+    __m256d speed = _mm256_sqrt_pd(_mm256_fmadd_pd(wx, wx, _mm256_mul_pd(wy, wy)));
+
+    // Direction FROM, normalized to [0, 360)
+    __m256d dir = _mm256_mul_pd(v_atan2(wx, wy), _mm256_set1_pd(units::rad_to_deg));
+    __m256d neg = _mm256_cmp_pd(dir, _mm256_setzero_pd(), _CMP_LT_OQ);
+    dir = _mm256_blendv_pd(dir, _mm256_add_pd(dir, _mm256_set1_pd(units::angle_wrap)), neg);
+
+    // Head/cross components relative to track
+    __m256d rel_rad = _mm256_mul_pd(v_wrap_half_circle(_mm256_sub_pd(dir, track)), deg_to_rad);
+    // Sign-bit flip, not 0 - x: the scalar negation keeps -0.0 when the
+    // wind speed is zero, and 0 - (+0) would turn it into +0.0
+    __m256d head    = _mm256_xor_pd(_mm256_mul_pd(speed, v_cos(rel_rad)), _mm256_set1_pd(-0.0));
+    __m256d cross   = _mm256_mul_pd(speed, v_sin(rel_rad));
+
+    double speed_a[simd_width];
+    double dir_a[simd_width];
+    double head_a[simd_width];
+    double cross_a[simd_width];
+    _mm256_storeu_pd(speed_a, speed);
+    _mm256_storeu_pd(dir_a, dir);
+    _mm256_storeu_pd(head_a, head);
+    _mm256_storeu_pd(cross_a, cross);
+
+    for (int lane = 0; lane < simd_width; ++lane)
+    {
+        results[lane].speed_kts      = speed_a[lane];
+        results[lane].direction_from = dir_a[lane];
+        results[lane].headwind       = head_a[lane];
+        results[lane].crosswind      = cross_a[lane];
+    }
+}
+
+// Envelope margins for four samples at once
+__attribute__((target("avx2,fma"))) void envelope_lanes(const batch::Sample* samples,      // >= 4 samples
+                                                        calc::EnvelopeMargins* results)   // 4 results
+{
+    __m256d bank = _mm256_set_pd(samples[3].bank_deg, samples[2].bank_deg, samples[1].bank_deg, samples[0].bank_deg);
+    __m256d ias  = _mm256_set_pd(samples[3].ias_kts, samples[2].ias_kts, samples[1].ias_kts, samples[0].ias_kts);
+    __m256d mach = _mm256_set_pd(samples[3].mach, samples[2].mach, samples[1].mach, samples[0].mach);
+    __m256d vso  = _mm256_set_pd(samples[3].vso_kts, samples[2].vso_kts, samples[1].vso_kts, samples[0].vso_kts);
+    __m256d vne  = _mm256_set_pd(samples[3].vne_kts, samples[2].vne_kts, samples[1].vne_kts, samples[0].vne_kts);
+    __m256d mmo  = _mm256_set_pd(samples[3].mmo, samples[2].mmo, samples[1].mmo, samples[0].mmo);
+
+    __m256d one     = _mm256_set1_pd(1.0);
+    __m256d hundred = _mm256_set1_pd(100.0);
+
+    __m256d load = _mm256_div_pd(one, v_cos(_mm256_mul_pd(bank, _mm256_set1_pd(units::deg_to_rad))));
+    __m256d vs   = _mm256_mul_pd(vso, _mm256_sqrt_pd(load));
+
+    __m256d stall = _mm256_mul_pd(_mm256_div_pd(_mm256_sub_pd(ias, vs), vs), hundred);
+    __m256d vmo   = _mm256_mul_pd(_mm256_div_pd(_mm256_sub_pd(vne, ias), vne), hundred);
+    __m256d mmo_m = _mm256_mul_pd(_mm256_div_pd(_mm256_sub_pd(mmo, mach), mmo), hundred);
+    __m256d min_m = _mm256_min_pd(stall, _mm256_min_pd(vmo, mmo_m));
+
+    __m256d corner = _mm256_mul_pd(vs, _mm256_set1_pd(calc::sqrt_two));
+
+    double stall_a[simd_width];
+    double vmo_a[simd_width];
+    double mmo_a[simd_width];
+    double min_a[simd_width];
+    double load_a[simd_width];
+    double corner_a[simd_width];
+    _mm256_storeu_pd(stall_a, stall);
+    _mm256_storeu_pd(vmo_a, vmo);
+    _mm256_storeu_pd(mmo_a, mmo_m);
+    _mm256_storeu_pd(min_a, min_m);
+    _mm256_storeu_pd(load_a, load);
+    _mm256_storeu_pd(corner_a, corner);
+
+    for (int lane = 0; lane < simd_width; ++lane)
+    {
+        results[lane].stall_margin_pct = stall_a[lane];
+        results[lane].vmo_margin_pct   = vmo_a[lane];
+        results[lane].mmo_margin_pct   = mmo_a[lane];
+        results[lane].min_margin_pct   = min_a[lane];
+        results[lane].load_factor      = load_a[lane];
+        results[lane].corner_speed_kts = corner_a[lane];
+    }
+}
+
+constexpr int simd_width_f32 = 8;  // floats per AVX2 register
+
+// Cephes single-precision cos kernel coefficients, |x| <= pi/2
+constexpr float cos_f32_c2 = -5.0000000000e-1F;
+constexpr float cos_f32_c4 = 4.1666645557e-2F;
+constexpr float cos_f32_c6 = -1.3887316255e-3F;
+constexpr float cos_f32_c8 = 2.4433157103e-5F;
+
+// cos(x) for |x| <= pi/2; bank angles in the flight envelope stay well
+// inside the range, so no argument reduction is needed
+__attribute__((target("avx2,fma"))) inline __m256 v_cos_f32(__m256 x)
+{
+    __m256 x2 = _mm256_mul_ps(x, x);
+    __m256 p  = _mm256_set1_ps(cos_f32_c8);
+
+    p = _mm256_fmadd_ps(p, x2, _mm256_set1_ps(cos_f32_c6));
+    p = _mm256_fmadd_ps(p, x2, _mm256_set1_ps(cos_f32_c4));
+    p = _mm256_fmadd_ps(p, x2, _mm256_set1_ps(cos_f32_c2));
+
+    return _mm256_fmadd_ps(p, x2, _mm256_set1_ps(1.0F));
+}
+
+// Envelope margins for eight SoA samples at once.  Every operand is a
+// unit-stride load straight from a field array; results store the same way.
+__attribute__((target("avx2,fma"))) void envelope_lanes_f32(const batch::SampleBlockF32& block,
+                                                            size_t i,  // Lane base index
+                                                            batch::EnvelopeBlockF32& results)
+{
+    __m256 bank = _mm256_loadu_ps(&block.bank_deg[i]);
+    __m256 ias  = _mm256_loadu_ps(&block.ias_kts[i]);
+    __m256 mach = _mm256_loadu_ps(&block.mach[i]);
+    __m256 vso  = _mm256_loadu_ps(&block.vso_kts[i]);
+    __m256 vne  = _mm256_loadu_ps(&block.vne_kts[i]);
+    __m256 mmo  = _mm256_loadu_ps(&block.mmo[i]);
+
+    __m256 one     = _mm256_set1_ps(1.0F);
+    __m256 hundred = _mm256_set1_ps(100.0F);
+
+    __m256 load = _mm256_div_ps(one, v_cos_f32(_mm256_mul_ps(bank, _mm256_set1_ps(static_cast<float>(units::deg_to_rad)))));
+    __m256 vs   = _mm256_mul_ps(vso, _mm256_sqrt_ps(load));
+
+    __m256 stall = _mm256_mul_ps(_mm256_div_ps(_mm256_sub_ps(ias, vs), vs), hundred);
+    __m256 vmo   = _mm256_mul_ps(_mm256_div_ps(_mm256_sub_ps(vne, ias), vne), hundred);
+    __m256 mmo_m = _mm256_mul_ps(_mm256_div_ps(_mm256_sub_ps(mmo, mach), mmo), hundred);
+    __m256 min_m = _mm256_min_ps(stall, _mm256_min_ps(vmo, mmo_m));
+
+    __m256 corner = _mm256_mul_ps(vs, _mm256_set1_ps(static_cast<float>(calc::sqrt_two)));
+
+    _mm256_storeu_ps(&results.stall_margin_pct[i], stall);
+    _mm256_storeu_ps(&results.vmo_margin_pct[i], vmo);
+    _mm256_storeu_ps(&results.mmo_margin_pct[i], mmo_m);
+    _mm256_storeu_ps(&results.min_margin_pct[i], min_m);
+    _mm256_storeu_ps(&results.load_factor[i], load);
+    _mm256_storeu_ps(&results.corner_speed_kts[i], corner);
+}
+
+}  // namespace
+
+#endif  // AIRV_SIMD_X86
+
+void calculate_wind_vector_batch(const batch::Sample* samples,
+                                 size_t count,
+                                 calc::WindData* results,
+                                 calc::SensorHistoryBuffer& ias_buffer)
+{
+#if AIRV_SIMD_X86
+    if (avx2_available())
+    {
+        size_t i = 0;
+        for (; i + simd_width <= count; i += simd_width)
+        {
+            wind_vector_lanes(&samples[i], &results[i]);
+        }
+        // Scalar tail via the reference kernel (gust filled below for all)
+        for (; i < count; ++i)
+        {
+            results[i] = calc::calculate_wind_vector(samples[i].tas_kts,
+                                                     samples[i].gs_kts,
+                                                     samples[i].heading_deg,
+                                                     samples[i].track_deg,
+                                                     0.0);
+        }
+
+        // Gust statistics are inherently sequential (overlapping windows),
+        // but the buffer maintains them incrementally so this pass is O(n)
+        for (size_t j = 0; j < count; ++j)
+        {
+            ias_buffer.add_reading(samples[j].ias_kts);
+            results[j].gust_factor = ias_buffer.gust_factor();
+        }
+        return;
+    }
+#endif
+    batch::calculate_wind_vector_batch(samples, count, results, ias_buffer);
+}
+
+void calculate_envelope_batch(const batch::Sample* samples,
+                              size_t count,
+                              calc::EnvelopeMargins* results)
+{
+#if AIRV_SIMD_X86
+    if (avx2_available())
+    {
+        size_t i = 0;
+        for (; i + simd_width <= count; i += simd_width)
+        {
+            envelope_lanes(&samples[i], &results[i]);
+        }
+        for (; i < count; ++i)
+        {
+            results[i] = calc::calculate_envelope(samples[i].bank_deg,
+                                                  samples[i].ias_kts,
+                                                  samples[i].mach,
+                                                  samples[i].vso_kts,
+                                                  samples[i].vne_kts,
+                                                  samples[i].mmo);
+        }
+        return;
+    }
+#endif
+    batch::calculate_envelope_batch(samples, count, results);
+}
+
+void calculate_envelope_block_f32(const batch::SampleBlockF32& block,
+                                  size_t count,
+                                  batch::EnvelopeBlockF32& results)
+{
+#if AIRV_SIMD_X86
+    if (avx2_available())
+    {
+        size_t i = 0;
+        for (; i + simd_width_f32 <= count; i += simd_width_f32)
+        {
+            envelope_lanes_f32(block, i, results);
+        }
+        // Scalar tail, same float math as the reference loop
+        for (; i < count; ++i)
+        {
+            float load      = 1.0F / cosf(block.bank_deg[i] * static_cast<float>(units::deg_to_rad));
+            float vs_actual = block.vso_kts[i] * sqrtf(load);
+            float stall     = ((block.ias_kts[i] - vs_actual) / vs_actual) * 100.0F;
+            float vmo       = ((block.vne_kts[i] - block.ias_kts[i]) / block.vne_kts[i]) * 100.0F;
+            float mmo_m     = ((block.mmo[i] - block.mach[i]) / block.mmo[i]) * 100.0F;
+
+            results.stall_margin_pct[i] = stall;
+            results.vmo_margin_pct[i]   = vmo;
+            results.mmo_margin_pct[i]   = mmo_m;
+            results.min_margin_pct[i]   = fminf(stall, fminf(vmo, mmo_m));
+            results.load_factor[i]      = load;
+            results.corner_speed_kts[i] = vs_actual * static_cast<float>(calc::sqrt_two);
+        }
+        return;
+    }
+#endif
+    batch::calculate_envelope_block_f32_ref(block, count, results);
+}
+
+}  // namespace simd
+}  // namespace airv
\ No newline at end of file
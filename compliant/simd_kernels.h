@@ -0,0 +1,52 @@
+// SIMD-vectorized calculation kernels for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// Explicitly vectorized variants of the hot batch kernels: the wind vector
+// and envelope loops process four samples per iteration with AVX2 and
+// polynomial sin/cos/atan2 approximations (absolute angle error is below
+// 1e-5 deg, far under the 0.01 resolution the display prints).  The CPU is
+// probed once at runtime; machines without AVX2+FMA transparently run the
+// scalar reference loops from batch_calc.h, which always remain the
+// authority on correctness.
+
+#ifndef SIMD_KERNELS
+#define SIMD_KERNELS
+
+#include "batch_calc.h"
+#include "batch_soa.h"
+#include "flight_calc.h"
+#include "xplane_mfd_calc.h"
+#include <cstddef>
+
+namespace airv
+{
+namespace simd
+{
+
+// True when the AVX2+FMA paths are compiled in and the CPU supports them
+bool avx2_available(void);
+
+// Wind vectors over a telemetry stream, four samples per iteration.
+// Trig runs vectorized; the gust window stays a sequential scalar pass
+// because each sample's window overlaps its neighbours'.
+void calculate_wind_vector_batch(const batch::Sample* samples,
+                                 size_t count,
+                                 calc::WindData* results,
+                                 calc::SensorHistoryBuffer& ias_buffer);
+
+// Envelope margins, four samples per iteration
+void calculate_envelope_batch(const batch::Sample* samples,
+                              size_t count,
+                              calc::EnvelopeMargins* results);
+
+// Envelope margins over a float32 SoA block, eight samples per iteration.
+// Unit-stride full-width loads from the per-field arrays; without AVX2 the
+// reference loop from batch_soa.h runs instead.
+void calculate_envelope_block_f32(const batch::SampleBlockF32& block,
+                                  size_t count,
+                                  batch::EnvelopeBlockF32& results);
+
+}  // namespace simd
+}  // namespace airv
+
+#endif  // !SIMD_KERNELS
@@ -0,0 +1,171 @@
+// Multi-aircraft parallel evaluation engine for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// Pool mechanics: evaluate() bumps a generation counter under the mutex and
+// broadcasts; each helper computes its index stripe and decrements the
+// active-helper count, signalling the caller when the frame is complete.
+// The calling thread works lane 0 itself, so four lanes run on four cores
+// with exactly one wakeup and one completion wait per frame.
+
+#include "traffic_engine.h"
+
+namespace airv
+{
+namespace traffic
+{
+
+TrafficEngine::TrafficEngine()
+    : states_(nullptr),
+      results_(nullptr),
+      count_(0),
+      generation_(0U),
+      active_helpers_(0),
+      running_(false)
+{
+    pthread_mutex_init(&mutex_, nullptr);
+    pthread_cond_init(&work_ready_, nullptr);
+    pthread_cond_init(&work_done_, nullptr);
+}
+
+bool TrafficEngine::start()
+{
+    bool ok = !running_;
+
+    if (ok)
+    {
+        running_ = true;
+        for (int32_t i = 0; ok && i < helper_count; ++i)
+        {
+            lane_args_[i].engine = this;
+            lane_args_[i].lane   = i + 1;  // Lane 0 is the calling thread
+            ok = (pthread_create(&threads_[i], nullptr, worker_main, &lane_args_[i]) == 0);
+            if (!ok)
+            {
+                // Roll back the threads that did start; the flag flips
+                // under the mutex because they read it there
+                pthread_mutex_lock(&mutex_);
+                running_ = false;
+                pthread_cond_broadcast(&work_ready_);
+                pthread_mutex_unlock(&mutex_);
+                for (int32_t j = 0; j < i; ++j)
+                {
+                    pthread_join(threads_[j], nullptr);
+                }
+            }
+        }
+    }
+
+    return ok;
+}
+
+void TrafficEngine::stop()
+{
+    if (running_)
+    {
+        pthread_mutex_lock(&mutex_);
+        running_ = false;
+        pthread_cond_broadcast(&work_ready_);
+        pthread_mutex_unlock(&mutex_);
+
+        for (int32_t i = 0; i < helper_count; ++i)
+        {
+            pthread_join(threads_[i], nullptr);
+        }
+    }
+}
+
+void TrafficEngine::evaluate(const TrafficState* states,
+                             int32_t count,
+                             TrafficResult* results)
+{
+    if (count > max_aircraft)
+    {
+        count = max_aircraft;
+    }
+
+    pthread_mutex_lock(&mutex_);
+    states_         = states;
+    results_        = results;
+    count_          = count;
+    active_helpers_ = helper_count;
+    ++generation_;
+    pthread_cond_broadcast(&work_ready_);
+    pthread_mutex_unlock(&mutex_);
+
+    // The caller is lane 0; helpers run lanes 1..helper_count in parallel
+    process_slice(0);
+
+    pthread_mutex_lock(&mutex_);
+    while (active_helpers_ > 0)
+    {
+        pthread_cond_wait(&work_done_, &mutex_);
+    }
+    pthread_mutex_unlock(&mutex_);
+
+    // The frame is complete; expose its ship count to snapshot readers
+    snapshots_.set_count(count);
+}
+
+void* TrafficEngine::worker_main(void* arg)
+{
+    LaneArg* lane_arg = static_cast<LaneArg*>(arg);
+
+    lane_arg->engine->run_worker(lane_arg->lane);
+
+    return nullptr;
+}
+
+void TrafficEngine::run_worker(int32_t lane)
+{
+    uint64_t seen_generation = 0U;
+    bool keep_running        = true;
+
+    while (keep_running)
+    {
+        pthread_mutex_lock(&mutex_);
+        while (running_ && generation_ == seen_generation)
+        {
+            pthread_cond_wait(&work_ready_, &mutex_);
+        }
+        keep_running    = running_;
+        seen_generation = generation_;
+        pthread_mutex_unlock(&mutex_);
+
+        if (keep_running)
+        {
+            process_slice(lane);
+
+            pthread_mutex_lock(&mutex_);
+            --active_helpers_;
+            if (active_helpers_ == 0)
+            {
+                pthread_cond_signal(&work_done_);
+            }
+            pthread_mutex_unlock(&mutex_);
+        }
+    }
+}
+
+void TrafficEngine::process_slice(int32_t lane)
+{
+    for (int32_t i = lane; i < count_; i += lane_count)
+    {
+        const TrafficState& ship = states_[i];
+
+        results_[i].envelope = calc::calculate_envelope(
+            ship.bank_deg, ship.ias_kts, ship.mach, ship.vso_kts, ship.vne_kts, ship.mmo);
+        results_[i].turn   = calc::calculate_turn_performance(ship.tas_kts, ship.bank_deg, ship.course_change_deg);
+        results_[i].energy = calc::calculate_energy(ship.tas_kts, ship.altitude_ft, ship.vs_fpm);
+
+        // Publish this ship's slot lock-free; each slot has exactly one
+        // writer per frame (the lane its index stripes onto)
+        snap::CalcSnapshot snapshot{};
+        snapshot.envelope = results_[i].envelope;
+        snapshot.turn     = results_[i].turn;
+        snapshot.energy   = results_[i].energy;
+        snapshots_.publish(i, snapshot);
+    }
+}
+
+}  // namespace traffic
+}  // namespace airv
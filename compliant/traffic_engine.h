@@ -0,0 +1,113 @@
+// Multi-aircraft parallel evaluation engine for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// Fans one frame of AI-traffic aircraft states across a fixed pool of worker
+// threads and runs the envelope, turn performance and energy kernels per
+// ship.  The pool is created once at startup and never grows; work is handed
+// out by static index striping, so evaluation allocates nothing and the
+// frame's results land in one caller-owned array that is complete (and
+// therefore coherent) when evaluate() returns.
+
+#ifndef TRAFFIC_ENGINE
+#define TRAFFIC_ENGINE
+
+#include "flight_calc.h"
+#include "seqlock_snapshot.h"
+#include "turn_calc.h"
+#include <cstdint>
+#include <pthread.h>
+
+namespace airv
+{
+namespace traffic
+{
+
+// Fixed limits: X-Plane publishes at most 64 AI aircraft
+constexpr int32_t max_aircraft = 64;
+
+// Helper threads beyond the calling thread; together they fill four cores
+constexpr int32_t helper_count = 3;
+constexpr int32_t lane_count   = helper_count + 1;
+
+// Published state of one AI aircraft, as received from the simulator
+struct TrafficState
+{
+    double tas_kts;            // True airspeed (knots)
+    double ias_kts;            // Indicated airspeed (knots)
+    double mach;               // Mach number
+    double altitude_ft;        // Altitude (feet)
+    double vs_fpm;             // Vertical speed (feet/min)
+    double bank_deg;           // Bank angle (deg)
+    double course_change_deg;  // Course change to next leg (deg)
+    double vso_kts;            // Stall speed in landing config (knots IAS)
+    double vne_kts;            // Velocity never exceed (knots IAS)
+    double mmo;                // Maximum operating Mach number
+};
+
+// All per-ship outputs for the traffic page
+struct TrafficResult
+{
+    calc::EnvelopeMargins envelope;
+    calc::TurnData turn;
+    calc::EnergyData energy;
+};
+
+// Fixed-size worker pool; one instance lives for the daemon's lifetime
+class TrafficEngine
+{
+public:
+    TrafficEngine();
+
+    // Create the helper threads; returns false if any thread fails to start
+    bool start();
+
+    // Signal the helpers to exit and join them; safe to call when not started
+    void stop();
+
+    bool is_running() const { return running_; }
+
+    // Evaluate one frame of aircraft states.  Blocks until every ship in
+    // results[0..count) is written; count is clamped to max_aircraft.
+    void evaluate(const TrafficState* states,   // One state per ship
+                  int32_t count,                // Ship count this frame
+                  TrafficResult* results);      // One result per ship
+
+    // Lock-free per-ship snapshots of the latest frame; display readers go
+    // through here so they never block the compute lanes
+    const snap::SnapshotTable& snapshots() const { return snapshots_; }
+
+private:
+    static void* worker_main(void* arg);
+
+    void run_worker(int32_t lane);
+
+    // Compute every ship whose index lands on this lane's stripe
+    void process_slice(int32_t lane);
+
+    pthread_t threads_[helper_count];
+    pthread_mutex_t mutex_;
+    pthread_cond_t work_ready_;
+    pthread_cond_t work_done_;
+
+    const TrafficState* states_;
+    TrafficResult* results_;
+    snap::SnapshotTable snapshots_;
+    int32_t count_;
+    uint64_t generation_;     // Bumped once per evaluate(); wakes the helpers
+    int32_t active_helpers_;  // Helpers still working on this generation
+    bool running_;
+
+    // Lane identity passed to pthread_create without heap allocation
+    struct LaneArg
+    {
+        TrafficEngine* engine;
+        int32_t lane;
+    };
+
+    LaneArg lane_args_[helper_count];
+};
+
+}  // namespace traffic
+}  // namespace airv
+
+#endif  // !TRAFFIC_ENGINE
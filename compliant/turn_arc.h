@@ -0,0 +1,135 @@
+// Turn trajectory arc generator for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// calculate_turn_performance yields scalar radius/rate/lead numbers; the
+// MFD needs the predicted ground path itself.  This generator emits a
+// fixed-capacity polyline of the turn arc followed by the straight rollout
+// segment, in nautical miles east/north of the present position.  The only
+// trig is one sin/cos pair for the initial heading and one for the step
+// angle; every further point comes from complex-multiply rotation of a
+// unit vector, so a 128-point arc is a few hundred multiply-adds.
+
+#ifndef TURN_ARC
+#define TURN_ARC
+
+#include "turn_calc.h"
+#include "xplane_mfd_calc.h"
+#include <cmath>
+#include <cstdint>
+
+namespace airv
+{
+namespace calc
+{
+
+// Polyline capacity; 128 draws glass-smooth arcs at MFD zoom levels
+constexpr int32_t max_arc_points     = 128;
+constexpr int32_t default_arc_points = 64;
+
+// Points reserved for the straight rollout after the arc completes
+constexpr int32_t rollout_point_divisor = 4;
+
+// Rollout length when the turn data offers no usable lead distance
+constexpr double default_rollout_nm = 1.0;
+
+// Predicted ground track, east/north offsets from the present position
+struct TurnArc
+{
+    int32_t point_count;
+    double east_nm[max_arc_points];
+    double north_nm[max_arc_points];
+};
+
+// Generate the arc-plus-rollout polyline.  The sign of course_change_deg
+// selects the turn direction (positive = right).  A wings-level result
+// (infinite radius) degenerates to a straight run on the current heading.
+inline void calculate_turn_arc(const TurnData& turn,       // From calculate_turn_performance
+                               double heading_deg,         // Present heading (degrees true)
+                               double course_change_deg,   // Signed course change (degrees)
+                               int32_t point_count,        // Total polyline points
+                               TurnArc& arc)
+{
+    if (point_count < 2)
+    {
+        point_count = 2;
+    }
+    if (point_count > max_arc_points)
+    {
+        point_count = max_arc_points;
+    }
+
+    int32_t rollout_points = point_count / rollout_point_divisor;
+    int32_t arc_points     = point_count - rollout_points;
+
+    double heading_rad = heading_deg * units::deg_to_rad;
+    double rollout_nm  = (turn.lead_distance_nm > 0.0 && turn.lead_distance_nm < infinite_radius_nm)
+                             ? turn.lead_distance_nm
+                             : default_rollout_nm;
+
+    // Unit direction of flight, stepped by complex multiplication below
+    double dir_east  = sin(heading_rad);
+    double dir_north = cos(heading_rad);
+
+    arc.point_count = point_count;
+    arc.east_nm[0]  = 0.0;
+    arc.north_nm[0] = 0.0;
+
+    if (turn.radius_nm >= infinite_radius_nm || course_change_deg == 0.0)
+    {
+        // Wings level: one straight segment over all points
+        double step_nm = rollout_nm / (point_count - 1);
+
+        for (int32_t i = 1; i < point_count; ++i)
+        {
+            arc.east_nm[i]  = arc.east_nm[i - 1] + (dir_east * step_nm);
+            arc.north_nm[i] = arc.north_nm[i - 1] + (dir_north * step_nm);
+        }
+    }
+    else
+    {
+        // Arc: rotate the flight direction by the step angle each point and
+        // advance by the chord length R * 2 * sin(step / 2).  The chord
+        // heading leads the point's tangent by half a step, so the polyline
+        // vertices land exactly on the circle.
+        double sweep_rad = course_change_deg * units::deg_to_rad;
+        double step_rad  = sweep_rad / (arc_points - 1);
+        double step_cos  = cos(step_rad);
+        double step_sin  = sin(step_rad);
+        double chord_nm  = 2.0 * turn.radius_nm * fabs(sin(step_rad * 0.5));
+
+        // Start the chord direction half a step into the turn
+        double half_cos = cos(step_rad * 0.5);
+        double half_sin = sin(step_rad * 0.5);
+        double chord_east  = (dir_east * half_cos) + (dir_north * half_sin);
+        double chord_north = (dir_north * half_cos) - (dir_east * half_sin);
+
+        for (int32_t i = 1; i < arc_points; ++i)
+        {
+            arc.east_nm[i]  = arc.east_nm[i - 1] + (chord_east * chord_nm);
+            arc.north_nm[i] = arc.north_nm[i - 1] + (chord_north * chord_nm);
+
+            // One complex multiply advances the chord to the next step
+            double next_east  = (chord_east * step_cos) + (chord_north * step_sin);
+            double next_north = (chord_north * step_cos) - (chord_east * step_sin);
+            chord_east        = next_east;
+            chord_north       = next_north;
+        }
+
+        // Rollout: straight on the final heading
+        double final_rad   = (heading_deg + course_change_deg) * units::deg_to_rad;
+        double final_east  = sin(final_rad);
+        double final_north = cos(final_rad);
+        double step_nm     = rollout_nm / (rollout_points > 0 ? rollout_points : 1);
+
+        for (int32_t i = arc_points; i < point_count; ++i)
+        {
+            arc.east_nm[i]  = arc.east_nm[i - 1] + (final_east * step_nm);
+            arc.north_nm[i] = arc.north_nm[i - 1] + (final_north * step_nm);
+        }
+    }
+}
+
+}  // namespace calc
+}  // namespace airv
+
+#endif  // !TURN_ARC
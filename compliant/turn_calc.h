@@ -0,0 +1,137 @@
+// Turn performance calculation core for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// Shared between the turn_calculator CLI and the mfd_calcd daemon.
+// Calculates turn performance metrics:
+// - Turn radius
+// - Turn rate (degrees per second)
+// - Lead turn distance for course changes
+// - Standard rate bank angle
+// - Time to turn
+
+#ifndef TURN_CALC
+#define TURN_CALC
+
+#include "json_writer.h"
+#include "xplane_mfd_calc.h"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+
+namespace airv
+{
+namespace calc
+{
+
+// Mathematical constants
+constexpr double standard_rate = 3.0;  // degrees per second
+
+// Calculation constants
+constexpr double infinite_radius_nm      = 999.9;
+constexpr double infinite_radius_ft      = 999900.0;
+constexpr double zero_turn_rate          = 0.0;
+constexpr double min_tan_threshold       = 0.001;
+constexpr double min_turn_rate_threshold = 0.01;
+constexpr double meters_per_nm           = 1852.0;
+constexpr double feet_per_meter          = 3.28084;
+
+struct TurnData
+{
+    double radius_nm;           // Turn radius in nautical miles
+    double radius_ft;           // Turn radius in feet
+    double turn_rate_dps;       // Turn rate in degrees per second
+    double lead_distance_nm;    // Lead distance to roll out
+    double lead_distance_ft;    // Lead distance in feet
+    double time_to_turn_sec;    // Time to complete the turn
+    double load_factor;         // G-loading in the turn
+    double standard_rate_bank;  // Bank angle for standard rate turn
+};
+
+// Calculate comprehensive turn performance
+inline TurnData calculate_turn_performance(double tas_kts,
+                                           double bank_deg,
+                                           double course_change_deg)
+{
+    TurnData result;
+
+    // Convert inputs
+    double v_ms          = tas_kts * units::kts_to_ms;             // TAS in m/s
+    double phi_rad       = bank_deg * units::deg_to_rad;           // Bank angle in radians
+    double delta_psi_rad = course_change_deg * units::deg_to_rad;  // Course change in radians
+
+    // Calculate load factor
+    result.load_factor = 1.0 / cos(phi_rad);
+
+    // Turn radius: R = pow(V, 2) / (g * tan phi)
+    double tan_phi = tan(phi_rad);
+    if (fabs(tan_phi) < min_tan_threshold)
+    {
+        // Essentially wings level - infinite radius
+        result.radius_nm        = infinite_radius_nm;
+        result.radius_ft        = infinite_radius_ft;
+        result.turn_rate_dps    = zero_turn_rate;
+        result.lead_distance_nm = zero_turn_rate;
+        result.lead_distance_ft = zero_turn_rate;
+        result.time_to_turn_sec = infinite_time;
+    }
+    else
+    {
+        double radius_m = (v_ms * v_ms) / (units::gravity * tan_phi);
+
+        // Convert radius to NM and feet
+        result.radius_nm = radius_m / meters_per_nm;
+        result.radius_ft = radius_m * feet_per_meter;
+
+        // Turn rate: omega = (g * tan phi) / V (rad/s) -> convert to deg/s
+        double omega_rad_s   = (units::gravity * tan_phi) / v_ms;
+        result.turn_rate_dps = omega_rad_s * units::rad_to_deg;
+
+        // Lead distance: L = R * tan(Delta psi/2)
+        double lead_m           = radius_m * tan(delta_psi_rad / 2.0);
+        result.lead_distance_nm = lead_m / meters_per_nm;
+        result.lead_distance_ft = lead_m * feet_per_meter;
+
+        // Time to turn
+        if (fabs(result.turn_rate_dps) > min_turn_rate_threshold)
+        {
+            result.time_to_turn_sec = course_change_deg / result.turn_rate_dps;
+        }
+        else
+        {
+            result.time_to_turn_sec = infinite_time;
+        }
+    }
+
+    // Standard rate bank angle: phi = atan(omega * V / g) where omega = 3 deg/s
+    double std_rate_rad_s     = standard_rate * units::deg_to_rad;
+    double std_bank_rad       = atan((std_rate_rad_s * v_ms) / units::gravity);
+    result.standard_rate_bank = std_bank_rad * units::rad_to_deg;
+
+    return result;
+}
+
+// Output results as JSON (fixed buffer, no iostream formatting state)
+inline void print_json(const TurnData& turn,
+                       FILE* out = stdout)  // Reply sink; the daemon redirects per client
+{
+    static char buffer[json::default_buffer_size];
+    json::Writer writer(buffer, sizeof(buffer));
+
+    writer.open_object();
+    writer.field("radius_nm", turn.radius_nm);
+    writer.field("radius_ft", turn.radius_ft);
+    writer.field("turn_rate_dps", turn.turn_rate_dps);
+    writer.field("lead_distance_nm", turn.lead_distance_nm);
+    writer.field("lead_distance_ft", turn.lead_distance_ft);
+    writer.field("time_to_turn_sec", turn.time_to_turn_sec);
+    writer.field("load_factor", turn.load_factor);
+    writer.field("standard_rate_bank", turn.standard_rate_bank);
+    writer.close_object();
+
+    fwrite(writer.data(), 1, writer.length(), out);
+}
+
+}  // namespace calc
+}  // namespace airv
+
+#endif  // !TURN_CALC
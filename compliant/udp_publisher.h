@@ -0,0 +1,160 @@
+// UDP multicast result publisher for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// Publishes each computed frame as one UDP multicast datagram so any
+// number of display heads on the local network receive the same snapshot
+// for the cost of a single send.  The payload is the identical packed
+// ExchangeFrame the shared-memory segment carries, so a receiver reuses
+// the same struct.unpack layout, preceded by a small fixed header:
+//
+//   uint32 magic        exchange_magic, byte-order probe
+//   uint32 version      exchange_version, layout cross-check
+//   uint32 frame_bytes  sizeof(ExchangeFrame), second layout cross-check
+//   uint32 sequence     increments by one per datagram; a gap means loss
+//
+// The datagram is assembled with a two-element iovec handed to sendmsg --
+// header and the live frame -- so the frame bytes go from the daemon's
+// snapshot buffer to the kernel without an intermediate copy.  Sends are
+// fire-and-forget: a full socket buffer drops the datagram and bumps a
+// counter, it never blocks the request loop.
+
+#ifndef UDP_PUBLISHER
+#define UDP_PUBLISHER
+
+#include "shm_exchange.h"
+#include <arpa/inet.h>
+#include <cstdint>
+#include <cstring>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace airv
+{
+namespace net
+{
+
+// Default group/port when --mcast is given without an argument
+constexpr char default_multicast_group[] = "239.255.77.68";  // 239.255.'M'.'D'
+constexpr uint16_t default_multicast_port = 43110U;
+
+// Multicast stays on the local segment unless routed deliberately
+constexpr int multicast_ttl = 1;
+
+// Fixed prefix of every datagram, ahead of the packed ExchangeFrame
+struct DatagramHeader
+{
+    uint32_t magic;        // shm::exchange_magic
+    uint32_t version;      // shm::exchange_version
+    uint32_t frame_bytes;  // sizeof(shm::ExchangeFrame)
+    uint32_t sequence;     // Per-datagram counter, gaps signal loss
+};
+
+static_assert(sizeof(DatagramHeader) == 4U * sizeof(uint32_t), "DatagramHeader must stay packed");
+
+// Writer side of the multicast feed, used by mfd_calcd
+class MulticastPublisher
+{
+public:
+    MulticastPublisher()
+        : fd_(-1),
+          sequence_(0),
+          dropped_(0)
+    {
+        memset(&group_, 0, sizeof(group_));
+    }
+
+    ~MulticastPublisher() { close(); }
+
+    // Open the send socket; returns false if the group does not parse
+    // or the OS refuses the socket
+    bool open(const char* group,
+              uint16_t port)
+    {
+        bool ok = !is_open() && group != nullptr;
+
+        if (ok)
+        {
+            group_.sin_family = AF_INET;
+            group_.sin_port   = htons(port);
+            ok                = (inet_pton(AF_INET, group, &group_.sin_addr) == 1);
+        }
+        if (ok)
+        {
+            fd_ = socket(AF_INET, SOCK_DGRAM | SOCK_NONBLOCK, 0);
+            ok  = (fd_ >= 0);
+        }
+        if (ok)
+        {
+            int ttl = multicast_ttl;
+            ok      = (setsockopt(fd_, IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl)) == 0);
+        }
+        if (!ok)
+        {
+            close();
+        }
+
+        return ok;
+    }
+
+    bool is_open() const { return fd_ >= 0; }
+
+    // Emit one frame as a single datagram, straight from the caller's
+    // snapshot buffer; one send reaches every subscribed listener
+    void publish(const shm::ExchangeFrame& frame)
+    {
+        if (fd_ >= 0)
+        {
+            DatagramHeader header;
+            header.magic       = shm::exchange_magic;
+            header.version     = shm::exchange_version;
+            header.frame_bytes = static_cast<uint32_t>(sizeof(shm::ExchangeFrame));
+            header.sequence    = sequence_;
+
+            struct iovec parts[2];
+            parts[0].iov_base = &header;
+            parts[0].iov_len  = sizeof(header);
+            parts[1].iov_base = const_cast<shm::ExchangeFrame*>(&frame);
+            parts[1].iov_len  = sizeof(frame);
+
+            struct msghdr message;
+            memset(&message, 0, sizeof(message));
+            message.msg_name    = &group_;
+            message.msg_namelen = sizeof(group_);
+            message.msg_iov     = parts;
+            message.msg_iovlen  = 2;
+
+            ssize_t sent = sendmsg(fd_, &message, 0);
+
+            if (sent != static_cast<ssize_t>(sizeof(header) + sizeof(frame)))
+            {
+                // The number still advances, so receivers see the gap
+                ++dropped_;
+            }
+            ++sequence_;
+        }
+    }
+
+    uint64_t dropped_datagrams() const { return dropped_; }
+
+    void close()
+    {
+        if (fd_ >= 0)
+        {
+            ::close(fd_);
+            fd_ = -1;
+        }
+    }
+
+private:
+    struct sockaddr_in group_;
+    int fd_;
+    uint32_t sequence_;
+    uint64_t dropped_;
+};
+
+}  // namespace net
+}  // namespace airv
+
+#endif  // UDP_PUBLISHER
@@ -0,0 +1,136 @@
+// VNAV calculation core for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// Shared between the vnav_calculator CLI and the mfd_calcd daemon.
+// Calculates vertical navigation parameters:
+// - Top of Descent (TOD) distance
+// - Required vertical speed for path
+// - Flight path angle
+// - Time to altitude constraint
+
+#ifndef VNAV_CALC
+#define VNAV_CALC
+
+#include "json_writer.h"
+#include "xplane_mfd_calc.h"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+
+namespace airv
+{
+namespace calc
+{
+// Mathematical constants
+constexpr double three_deg_rad = 3.0 * units::deg_to_rad;
+
+// Calculation constants
+constexpr double vs_conversion_factor = 101.27;  // Converts GS*tan(gamma) to VS in fpm
+constexpr double min_distance_nm      = 0.01;
+constexpr double min_groundspeed_kts  = 1.0;
+constexpr double min_vs_for_time_calc = 1.0;
+constexpr double zero_distance        = 0.0;
+constexpr double thousand_feet        = 1000.0;
+
+struct VNAVData
+{
+    double altitude_to_lose_ft;     // Altitude change required
+    double flight_path_angle_deg;   // Flight path angle (negative = descent)
+    double required_vs_fpm;         // Required vertical speed
+    double tod_distance_nm;         // Top of descent distance (for 3 deg path)
+    double time_to_constraint_min;  // Time to reach altitude at current VS
+    double distance_per_1000ft;     // Distance traveled per 1000 ft altitude change
+    double vs_for_3deg;             // Vertical speed required for 3 deg path
+    bool is_descent;                // True if descending, false if climbing
+};
+
+// Calculate VNAV parameters
+inline VNAVData calculate_vnav(double current_alt_ft,   // Current altitude (feet)
+                               double target_alt_ft,    // Target altitude (feet)
+                               double distance_nm,      // Distance to constraint (nautical miles)
+                               double groundspeed_kts,  // Groundspeed (knots)
+                               double current_vs_fpm)   // Current vertical speed (feet per minute)
+{
+    VNAVData result;
+
+    // Calculate altitude change (positive = climb, negative = descend)
+    double altitude_change_ft  = target_alt_ft - current_alt_ft;
+    result.altitude_to_lose_ft = -altitude_change_ft;  // Legacy field name
+    result.is_descent          = altitude_change_ft < zero_distance;
+
+    // Avoid division by zero
+    if (distance_nm < min_distance_nm)
+        distance_nm = min_distance_nm;
+    if (groundspeed_kts < min_groundspeed_kts)
+        groundspeed_kts = min_groundspeed_kts;
+
+    // Calculate flight path angle (positive = climb, negative = descent)
+    double distance_ft           = distance_nm * units::nm_to_ft;
+    double gamma_rad             = atan(altitude_change_ft / distance_ft);
+    result.flight_path_angle_deg = gamma_rad * units::rad_to_deg;
+
+    // Required vertical speed to meet constraint
+    // VS = 101.27 * GS * tan(gamma)
+    result.required_vs_fpm = vs_conversion_factor * groundspeed_kts * tan(gamma_rad);
+
+    // Calculate TOD for standard 3 deg descent path
+    // D = h / (6076 * tan(3 deg)) or simplified: h / 319
+    double abs_alt_change  = fabs(altitude_change_ft);
+    result.tod_distance_nm = abs_alt_change / (units::nm_to_ft * tan(three_deg_rad));
+
+    // Vertical speed for 3 deg descent: VS is almost 5 * GS (rule of thumb)
+    // More precisely: VS = 101.27 * GS * tan(3 deg) is almost 5.3 * GS
+    result.vs_for_3deg = vs_conversion_factor * groundspeed_kts * tan(three_deg_rad);
+    if (!result.is_descent)
+    {
+        result.vs_for_3deg = -result.vs_for_3deg;  // Make positive for climb
+    }
+
+    // Time to reach constraint at current vertical speed
+    if (fabs(current_vs_fpm) > min_vs_for_time_calc)
+    {
+        result.time_to_constraint_min = altitude_change_ft / current_vs_fpm;
+    }
+    else
+    {
+        result.time_to_constraint_min = infinite_time;
+    }
+
+    // Distance per 1000 ft of altitude change
+    if (abs_alt_change > min_vs_for_time_calc)
+    {
+        result.distance_per_1000ft = (distance_nm * thousand_feet) / abs_alt_change;
+    }
+    else
+    {
+        result.distance_per_1000ft = zero_distance;
+    }
+
+    return result;
+}
+
+// Output results as JSON (fixed buffer, no iostream formatting state)
+inline void print_json(const VNAVData& vnav,
+                       FILE* out = stdout)  // Reply sink; the daemon redirects per client
+{
+    static char buffer[json::default_buffer_size];
+    json::Writer writer(buffer, sizeof(buffer));
+
+    writer.open_object();
+    writer.field("altitude_to_lose_ft", vnav.altitude_to_lose_ft);
+    writer.field("flight_path_angle_deg", vnav.flight_path_angle_deg);
+    writer.field("required_vs_fpm", vnav.required_vs_fpm);
+    writer.field("tod_distance_nm", vnav.tod_distance_nm);
+    writer.field("time_to_constraint_min", vnav.time_to_constraint_min);
+    writer.field("distance_per_1000ft", vnav.distance_per_1000ft);
+    writer.field("vs_for_3deg", vnav.vs_for_3deg);
+    writer.field_bool("is_descent", vnav.is_descent);
+    writer.close_object();
+
+    fwrite(writer.data(), 1, writer.length(), out);
+}
+
+}  // namespace calc
+}  // namespace airv
+
+#endif  // !VNAV_CALC
@@ -0,0 +1,266 @@
+// Multi-constraint VNAV descent profile planner for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// calculate_vnav handles one altitude constraint, so approximating a STAR
+// meant one call (or one subprocess) per waypoint per frame.  The planner
+// takes the whole arrival — up to 32 waypoints, each a distance, an
+// altitude window, and a leg speed — and solves the geometric descent in
+// two passes over fixed arrays: a backward sweep that projects the
+// standard 3-degree path up from the last constraint and clamps it into
+// each window, then a forward sweep that turns the clamped altitudes into
+// per-leg path angles and required vertical speeds, plus the cumulative
+// top-of-descent distance.
+//
+// The planner keeps the accepted constraints and replans only from the
+// last changed waypoint back toward the aircraft: a clamped altitude at
+// waypoint i depends only on waypoints at and beyond i, so legs past the
+// change are untouched.  On the common frame where just the active leg's
+// distance ticks down, the replan is one target and two legs, not the
+// whole arrival.  No heap, no exceptions; storage is preallocated at the
+// waypoint cap.
+
+#ifndef VNAV_PROFILE
+#define VNAV_PROFILE
+
+#include "vnav_calc.h"
+#include "xplane_mfd_calc.h"
+#include <cmath>
+#include <cstdint>
+
+namespace airv
+{
+namespace calc
+{
+
+// Arrival capacity; 32 covers the longest published STARs with room over
+constexpr int32_t max_vnav_waypoints = 32;
+
+// Altitude drop of the standard 3-degree path per nautical mile flown
+const double descent_ft_per_nm = units::nm_to_ft * tan(three_deg_rad);
+
+// Altitudes within this of each other are the same flight level for
+// replanning purposes
+constexpr double alt_epsilon_ft = 0.5;
+
+// One waypoint constraint: where it is, the altitude window to cross it
+// in, and the expected groundspeed on the leg ending there
+struct VNAVConstraint
+{
+    double distance_nm;  // Along-path distance from the present position
+    double alt_min_ft;   // Cross at or above ("at" windows set min == max)
+    double alt_max_ft;   // Cross at or below
+    double speed_kts;    // Leg groundspeed; <= 0 uses the aircraft's
+
+    VNAVConstraint()
+        : distance_nm(0.0),
+          alt_min_ft(0.0),
+          alt_max_ft(0.0),
+          speed_kts(0.0)
+    {
+    }
+};
+
+// Fixed-storage planner; constraints in, per-leg solution out
+class VNAVPlanner
+{
+public:
+    VNAVPlanner()
+        : waypoint_count_(0),
+          replan_from_(-1),
+          tod_distance_nm_(0.0),
+          descent_required_(false),
+          current_alt_ft_(0.0),
+          groundspeed_kts_(0.0),
+          legs_replanned_(0)
+    {
+        for (int32_t i = 0; i < max_vnav_waypoints; ++i)
+        {
+            target_alt_ft_[i]   = 0.0;
+            required_vs_fpm_[i] = 0.0;
+            path_angle_deg_[i]  = 0.0;
+        }
+    }
+
+    // Set the arrival length; a new length invalidates the whole plan
+    void set_count(int32_t count)
+    {
+        if (count < 0)
+        {
+            count = 0;
+        }
+        if (count > max_vnav_waypoints)
+        {
+            count = max_vnav_waypoints;
+        }
+        if (count != waypoint_count_)
+        {
+            waypoint_count_ = count;
+            replan_from_    = count - 1;
+        }
+    }
+
+    // Accept one constraint; the plan goes stale from this waypoint back
+    // toward the aircraft only when a field actually moved
+    void set_waypoint(int32_t index,
+                      const VNAVConstraint& constraint)
+    {
+        if (index >= 0 && index < waypoint_count_)
+        {
+            const VNAVConstraint& held = constraints_[index];
+            bool changed = fabs(constraint.distance_nm - held.distance_nm) > min_distance_nm ||
+                           fabs(constraint.alt_min_ft - held.alt_min_ft) > alt_epsilon_ft ||
+                           fabs(constraint.alt_max_ft - held.alt_max_ft) > alt_epsilon_ft ||
+                           fabs(constraint.speed_kts - held.speed_kts) > min_groundspeed_kts;
+
+            if (changed)
+            {
+                constraints_[index] = constraint;
+                if (index > replan_from_)
+                {
+                    replan_from_ = index;
+                }
+            }
+        }
+    }
+
+    // Solve (or incrementally re-solve) the profile for the present
+    // aircraft state.  Scalar state only touches the first leg and the
+    // TOD, so those are recomputed on every call regardless.
+    void plan(double current_alt_ft,    // Present altitude (feet)
+              double groundspeed_kts)   // Present groundspeed (knots)
+    {
+        current_alt_ft_  = current_alt_ft;
+        groundspeed_kts_ = groundspeed_kts;
+        legs_replanned_  = 0;
+
+        if (waypoint_count_ > 0)
+        {
+            // Backward sweep: from the last changed waypoint toward the
+            // aircraft, project the 3-degree path up a leg at a time and
+            // clamp it into each window.  Waypoints past the change keep
+            // their targets.
+            for (int32_t i = replan_from_; i >= 0; --i)
+            {
+                double ideal_ft = (i == waypoint_count_ - 1)
+                                      ? constraints_[i].alt_min_ft
+                                      : target_alt_ft_[i + 1] + (leg_length_nm(i + 1) * descent_ft_per_nm);
+
+                if (ideal_ft < constraints_[i].alt_min_ft)
+                {
+                    ideal_ft = constraints_[i].alt_min_ft;
+                }
+                if (ideal_ft > constraints_[i].alt_max_ft)
+                {
+                    ideal_ft = constraints_[i].alt_max_ft;
+                }
+                target_alt_ft_[i] = ideal_ft;
+            }
+
+            // Forward sweep: legs whose endpoint targets moved, plus the
+            // first leg whose geometry tracks the aircraft itself.  On a
+            // clean plan this degenerates to the first leg alone.
+            int32_t last_leg = replan_from_ + 1;
+            if (last_leg > waypoint_count_ - 1)
+            {
+                last_leg = waypoint_count_ - 1;
+            }
+            for (int32_t i = 0; i <= last_leg; ++i)
+            {
+                solve_leg(i);
+                ++legs_replanned_;
+            }
+
+            solve_tod();
+        }
+
+        replan_from_ = -1;
+    }
+
+    int32_t waypoint_count() const { return waypoint_count_; }
+
+    // Planned crossing altitude at each waypoint
+    double target_alt_ft(int32_t index) const { return target_alt_ft_[index]; }
+
+    // Required vertical speed on the leg ending at each waypoint
+    double required_vs_fpm(int32_t index) const { return required_vs_fpm_[index]; }
+
+    // Flight path angle of the leg ending at each waypoint
+    double path_angle_deg(int32_t index) const { return path_angle_deg_[index]; }
+
+    // Cumulative distance to the top of descent; 0 when already past it
+    double tod_distance_nm() const { return tod_distance_nm_; }
+
+    // False when the whole profile sits at or above the present altitude
+    bool descent_required() const { return descent_required_; }
+
+    // Legs actually re-solved by the last plan() call
+    int32_t legs_replanned() const { return legs_replanned_; }
+
+private:
+    // Length of the leg ending at waypoint index; the first leg starts at
+    // the aircraft
+    double leg_length_nm(int32_t index) const
+    {
+        double length = (index == 0)
+                            ? constraints_[0].distance_nm
+                            : constraints_[index].distance_nm - constraints_[index - 1].distance_nm;
+
+        return (length > min_distance_nm) ? length : min_distance_nm;
+    }
+
+    // Path angle and required VS for the leg ending at waypoint index
+    void solve_leg(int32_t index)
+    {
+        double start_alt_ft  = (index == 0) ? current_alt_ft_ : target_alt_ft_[index - 1];
+        double alt_change_ft = target_alt_ft_[index] - start_alt_ft;
+        double gamma_rad     = atan(alt_change_ft / (leg_length_nm(index) * units::nm_to_ft));
+        double leg_gs_kts    = (constraints_[index].speed_kts > min_groundspeed_kts)
+                                   ? constraints_[index].speed_kts
+                                   : groundspeed_kts_;
+
+        if (leg_gs_kts < min_groundspeed_kts)
+        {
+            leg_gs_kts = min_groundspeed_kts;
+        }
+
+        path_angle_deg_[index]  = gamma_rad * units::rad_to_deg;
+        required_vs_fpm_[index] = vs_conversion_factor * leg_gs_kts * tan(gamma_rad);
+    }
+
+    // Cumulative TOD: cruise until the 3-degree path into the first
+    // waypoint planned below the present altitude is intercepted
+    void solve_tod()
+    {
+        tod_distance_nm_  = 0.0;
+        descent_required_ = false;
+
+        for (int32_t i = 0; !descent_required_ && i < waypoint_count_; ++i)
+        {
+            if (target_alt_ft_[i] < current_alt_ft_ - alt_epsilon_ft)
+            {
+                double tod = constraints_[i].distance_nm -
+                             ((current_alt_ft_ - target_alt_ft_[i]) / descent_ft_per_nm);
+
+                tod_distance_nm_  = (tod > zero_distance) ? tod : zero_distance;
+                descent_required_ = true;
+            }
+        }
+    }
+
+    int32_t waypoint_count_;
+    VNAVConstraint constraints_[max_vnav_waypoints];  // Last accepted constraints
+    double target_alt_ft_[max_vnav_waypoints];        // Planned crossing altitudes
+    double required_vs_fpm_[max_vnav_waypoints];      // Per-leg required VS
+    double path_angle_deg_[max_vnav_waypoints];       // Per-leg path angle
+    int32_t replan_from_;                             // Last changed waypoint; -1 = clean
+    double tod_distance_nm_;
+    bool descent_required_;
+    double current_alt_ft_;
+    double groundspeed_kts_;
+    int32_t legs_replanned_;
+};
+
+}  // namespace calc
+}  // namespace airv
+
+#endif  // !VNAV_PROFILE
@@ -0,0 +1,97 @@
+// Wind calculation core for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// Shared between the wind_calculator CLI and the mfd_calcd daemon.
+// Calculates wind parameters from aircraft position and wind data:
+// - headwind
+// - crosswind
+// - wind correction angle
+
+#ifndef WIND_CALC
+#define WIND_CALC
+
+#include "json_writer.h"
+#include "xplane_mfd_calc.h"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+
+namespace airv
+{
+namespace calc
+{
+
+// Mathematical constants
+constexpr double wind_calm_threshold = 0.0;
+
+struct WindComponents
+{
+    double headwind;    // Positive = headwind, negative = tailwind
+    double crosswind;   // Positive = from right, negative = from left
+    double total_wind;  // Total wind speed
+    double wca;         // Wind correction angle
+    double drift;       // Drift angle (track - heading)
+};
+
+// Decompose a wind-from direction into headwind/crosswind along a track.
+// Single implementation shared by calculate_wind and calculate_wind_vector
+// (flight_calc.h) so the two wind paths cannot diverge.
+inline void wind_components_on_track(double wind_from_deg,    // Wind direction FROM (degrees)
+                                     double wind_speed_kts,   // Wind speed (knots)
+                                     double track_deg,        // Ground track (degrees true)
+                                     double& headwind_kts,    // Positive = headwind
+                                     double& crosswind_kts)   // Positive = from right
+{
+    // Fixed-point difference wraps for free; radians once at the trig boundary
+    units::Angle relative = units::Angle::from_degrees(wind_from_deg) -
+                            units::Angle::from_degrees(track_deg);
+    double wind_from_rad = relative.signed_radians();
+
+    headwind_kts  = -wind_speed_kts * cos(wind_from_rad);
+    crosswind_kts = wind_speed_kts * sin(wind_from_rad);
+}
+
+// Calculate wind components relative to aircraft track
+inline WindComponents calculate_wind(double track,       // Ground track (degrees true)
+                                     double heading,     // Aircraft heading (degrees)
+                                     double wind_dir,    // Wind direction FROM (degrees)
+                                     double wind_speed)  // Wind speed (knots)
+{
+    WindComponents result;
+
+    // Drift angle: one fixed-point subtraction, no wrap branches
+    result.drift = (units::Angle::from_degrees(track) - units::Angle::from_degrees(heading))
+                       .signed_degrees();
+
+    // Wind direction is where wind comes FROM; decompose along the track
+    wind_components_on_track(wind_dir, wind_speed, track, result.headwind, result.crosswind);
+    result.total_wind = wind_speed;
+
+    // Wind correction angle placeholder
+    result.wca = wind_calm_threshold;  // Cannot calculate without TAS
+
+    return result;
+}
+
+// Output results as JSON (fixed buffer, no iostream formatting state)
+inline void print_json(const WindComponents& wind,
+                       FILE* out = stdout)  // Reply sink; the daemon redirects per client
+{
+    static char buffer[json::default_buffer_size];
+    json::Writer writer(buffer, sizeof(buffer));
+
+    writer.open_object();
+    writer.field("headwind", wind.headwind);
+    writer.field("crosswind", wind.crosswind);
+    writer.field("total_wind", wind.total_wind);
+    writer.field("wca", wind.wca);
+    writer.field("drift", wind.drift);
+    writer.close_object();
+
+    fwrite(writer.data(), 1, writer.length(), out);
+}
+
+}  // namespace calc
+}  // namespace airv
+
+#endif  // !WIND_CALC
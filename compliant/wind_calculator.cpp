@@ -1,99 +1,16 @@
 // Wind Calculator for X-Plane MFD
 // JSF AV C++ Coding Standard Compliant Version
 //
-// Calculates wind parameters from aircraft position and wind data:
-// - headwind
-// - crosswind
-// - wind correction angle
+// CLI entry point; the calculation core lives in wind_calc.h so the
+// mfd_calcd daemon can reuse it without spawning this process.
 
+#include "batch_calc.h"
+#include "wind_calc.h"
 #include "xplane_mfd_calc.h"
-#include <cmath>
 #include <cstdint>
-#include <iomanip>
+#include <cstring>
 #include <iostream>
 
-namespace airv
-{
-namespace calc
-{
-
-// Mathematical constants
-constexpr double wind_calm_threshold = 0.0;
-
-struct WindComponents
-{
-    double headwind;    // Positive = headwind, negative = tailwind
-    double crosswind;   // Positive = from right, negative = from left
-    double total_wind;  // Total wind speed
-    double wca;         // Wind correction angle
-    double drift;       // Drift angle (track - heading)
-};
-
-// Normalize angle to 0-360 range
-double normalize_angle(double angle)
-{
-    double result = fmod(angle, units::angle_wrap);
-    if (result < wind_calm_threshold)
-    {
-        result += units::angle_wrap;
-    }
-    return result;
-}
-
-// Calculate wind components relative to aircraft track
-WindComponents calculate_wind(double track,       // Ground track (degrees true)
-                              double heading,     // Aircraft heading (degrees)
-                              double wind_dir,    // Wind direction FROM (degrees)
-                              double wind_speed)  // Wind speed (knots)
-{
-    WindComponents result;
-
-    // Normalize all angles
-    track    = normalize_angle(track);
-    heading  = normalize_angle(heading);
-    wind_dir = normalize_angle(wind_dir);
-
-    // Calculate drift angle
-    result.drift = normalize_angle(track - heading);
-    if (result.drift > units::half_circle)
-        result.drift -= units::angle_wrap;
-
-    // Wind direction is where wind comes FROM
-    // Calculate angle of wind-from relative to track
-    double wind_from_relative = normalize_angle(wind_dir - track);
-    if (wind_from_relative > units::half_circle)
-        wind_from_relative -= units::angle_wrap;
-
-    // Convert to radians for trig
-    double wind_from_rad = wind_from_relative * units::deg_to_rad;
-
-    // Calculate components using wind-from angle
-    result.headwind   = -wind_speed * cos(wind_from_rad);
-    result.crosswind  = wind_speed * sin(wind_from_rad);
-    result.total_wind = wind_speed;
-
-    // Wind correction angle placeholder
-    result.wca = wind_calm_threshold;  // Cannot calculate without TAS
-
-    return result;
-}
-
-// Output results as JSON
-void print_json(const WindComponents& wind)
-{
-    std::cout << std::fixed << std::setprecision(2);
-    std::cout << "{\n";
-    std::cout << "  \"headwind\": " << wind.headwind << ",\n";
-    std::cout << "  \"crosswind\": " << wind.crosswind << ",\n";
-    std::cout << "  \"total_wind\": " << wind.total_wind << ",\n";
-    std::cout << "  \"wca\": " << wind.wca << ",\n";
-    std::cout << "  \"drift\": " << wind.drift << "\n";
-    std::cout << "}\n";
-}
-
-}  // namespace calc
-}  // namespace airv
-
 void print_usage(const char* program_name)
 {
     std::cerr << "Usage: " << program_name << " <track> <heading> <wind_dir> <wind_speed>\n\n";
@@ -105,11 +22,27 @@ void print_usage(const char* program_name)
     std::cerr << "Example:\n";
     std::cerr << "  " << program_name << " 90 85 270 15\n";
     std::cerr << "  (Track 90°, Heading 85°, Wind from 270° at 15 knots)\n";
+    std::cerr << "Batch mode (raw WindSample records in, WindComponents records out):\n";
+    std::cerr << "  " << program_name << " --batch input.bin output.bin\n";
 }
 
 int main(int argc,
          char* argv[])
 {
+    // Replay mode: process a whole file of recorded samples in one process
+    if (argc == 4 && strcmp(argv[1], "--batch") == 0)
+    {
+        int64_t processed = airv::batch::run_batch_file<airv::batch::WindSample, airv::calc::WindComponents>(
+            argv[2], argv[3], airv::batch::calculate_wind_batch);
+        if (processed < 0)
+        {
+            std::cerr << "Error: Batch I/O failed\n";
+            return static_cast<int>(airv::Return_code::invalid_value);
+        }
+        std::cerr << "Processed " << processed << " samples\n";
+        return static_cast<int>(airv::Return_code::success);
+    }
+
     if (argc != 5)
     {
         print_usage(argv[0]);
@@ -152,4 +85,4 @@ int main(int argc,
     airv::calc::print_json(airv::calc::calculate_wind(track, heading, wind_dir, wind_speed));
 
     return static_cast<int>(airv::Return_code::success);
-}
\ No newline at end of file
+}
@@ -0,0 +1,190 @@
+// Altitude-banded wind history for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// calculate_wind_vector produces an instantaneous estimate and discards
+// it, but wind-shear warning on approach needs the wind the aircraft saw
+// at other altitudes minutes ago.  This store keeps one exponentially
+// weighted running wind vector per 500 ft altitude band over a fixed
+// 64-bin array: insert is a band index plus two multiply-adds, lookup is
+// the reverse, both O(1) with no allocation.  Estimates average the
+// north/east components, not the polar values, so bins straddling a
+// direction swing through north stay correct.
+//
+// The shear metric is the vector delta between the nearest occupied
+// bands below and above the query altitude, scaled per 1000 ft — the
+// classic approach-shear number — found with a short bounded scan.
+
+#ifndef WIND_HISTORY
+#define WIND_HISTORY
+
+#include "flight_calc.h"
+#include "vnav_calc.h"  // thousand_feet
+#include "xplane_mfd_calc.h"
+#include <cmath>
+#include <cstdint>
+
+namespace airv
+{
+namespace calc
+{
+
+// 64 bands of 500 ft cover the surface through FL320 individually; the
+// top band absorbs everything above
+constexpr int32_t wind_history_bins = 64;
+constexpr double wind_band_ft       = 500.0;
+
+// EWMA weight of each new estimate; ~4 samples dominate a bin
+constexpr double wind_ewma_alpha = 0.25;
+
+// Bands to scan on each side of the query for an occupied neighbor
+constexpr int32_t max_shear_span_bins = 8;
+
+// Shear across the query altitude, from the nearest occupied bands
+struct WindShearData
+{
+    double shear_kts;         // Vector wind delta between the two bands
+    double shear_per_1000ft;  // The same delta scaled per 1000 ft
+    double span_ft;           // Altitude separation of the bands used
+    bool valid;               // False until bands below and above exist
+};
+
+class WindHistory
+{
+public:
+    WindHistory()
+    {
+        for (int32_t i = 0; i < wind_history_bins; ++i)
+        {
+            north_kts_[i] = 0.0;
+            east_kts_[i]  = 0.0;
+            samples_[i]   = 0;
+        }
+    }
+
+    // Fold one wind estimate into its altitude band; O(1)
+    void record(double altitude_ft,
+                const WindData& wind)
+    {
+        int32_t bin    = band_index(altitude_ft);
+        double dir_rad = wind.direction_from * units::deg_to_rad;
+        double north   = wind.speed_kts * cos(dir_rad);
+        double east    = wind.speed_kts * sin(dir_rad);
+
+        if (samples_[bin] == 0)
+        {
+            north_kts_[bin] = north;
+            east_kts_[bin]  = east;
+        }
+        else
+        {
+            north_kts_[bin] += wind_ewma_alpha * (north - north_kts_[bin]);
+            east_kts_[bin] += wind_ewma_alpha * (east - east_kts_[bin]);
+        }
+        ++samples_[bin];
+    }
+
+    // Running estimate for the band holding altitude_ft; O(1).  Returns
+    // false for a band that never saw a sample.
+    bool estimate(double altitude_ft,
+                  double& speed_kts,
+                  double& direction_from) const
+    {
+        int32_t bin = band_index(altitude_ft);
+        bool found  = (samples_[bin] > 0);
+
+        if (found)
+        {
+            speed_kts      = sqrt((north_kts_[bin] * north_kts_[bin]) + (east_kts_[bin] * east_kts_[bin]));
+            direction_from = units::Angle::from_radians(atan2(east_kts_[bin], north_kts_[bin])).degrees();
+        }
+
+        return found;
+    }
+
+    // Vector shear across the query altitude, between the nearest
+    // occupied bands at-or-below and above it
+    WindShearData shear(double altitude_ft) const
+    {
+        WindShearData result;
+        result.shear_kts        = 0.0;
+        result.shear_per_1000ft = 0.0;
+        result.span_ft          = 0.0;
+        result.valid            = false;
+
+        int32_t bin   = band_index(altitude_ft);
+        int32_t below = -1;
+        int32_t above = -1;
+
+        for (int32_t step = 0; below < 0 && step <= max_shear_span_bins; ++step)
+        {
+            int32_t candidate = bin - step;
+            if (candidate >= 0 && samples_[candidate] > 0)
+            {
+                below = candidate;
+            }
+        }
+        for (int32_t step = 1; above < 0 && step <= max_shear_span_bins; ++step)
+        {
+            int32_t candidate = bin + step;
+            if (candidate < wind_history_bins && samples_[candidate] > 0)
+            {
+                above = candidate;
+            }
+        }
+
+        if (below >= 0 && above >= 0)
+        {
+            double delta_north = north_kts_[above] - north_kts_[below];
+            double delta_east  = east_kts_[above] - east_kts_[below];
+
+            result.shear_kts = sqrt((delta_north * delta_north) + (delta_east * delta_east));
+            result.span_ft   = (above - below) * wind_band_ft;
+            result.shear_per_1000ft =
+                (result.shear_kts * thousand_feet) / result.span_ft;
+            result.valid = true;
+        }
+
+        return result;
+    }
+
+    int32_t occupied_bins() const
+    {
+        int32_t count = 0;
+
+        for (int32_t i = 0; i < wind_history_bins; ++i)
+        {
+            if (samples_[i] > 0)
+            {
+                ++count;
+            }
+        }
+
+        return count;
+    }
+
+private:
+    int32_t band_index(double altitude_ft) const
+    {
+        int32_t bin = static_cast<int32_t>(altitude_ft / wind_band_ft);
+
+        if (bin < 0)
+        {
+            bin = 0;
+        }
+        if (bin >= wind_history_bins)
+        {
+            bin = wind_history_bins - 1;
+        }
+
+        return bin;
+    }
+
+    double north_kts_[wind_history_bins];  // EWMA wind vector per band
+    double east_kts_[wind_history_bins];
+    uint32_t samples_[wind_history_bins];  // 0 marks a never-seen band
+};
+
+}  // namespace calc
+}  // namespace airv
+
+#endif  // !WIND_HISTORY
@@ -1,6 +1,7 @@
 #ifndef XPLANE_MFD_CALC
 #define XPLANE_MFD_CALC
 
+#include <cmath>
 #include <cstdint>
 #include <cstdlib>
 
@@ -22,6 +23,70 @@ constexpr double nm_to_ft    = 6076.12;
 constexpr double angle_wrap  = 360.0;
 constexpr double half_circle = 180.0;
 
+// Binary angular measurement: the full circle is 2^32 counts, so
+// normalization is free integer wraparound and angle differences are
+// single subtractions — no fmod, no wrap branches
+constexpr double bam_full_circle = 4294967296.0;
+constexpr double deg_to_bam      = bam_full_circle / angle_wrap;
+constexpr double bam_to_deg      = angle_wrap / bam_full_circle;
+
+// The 2^31 count sitting exactly on the half circle
+constexpr uint32_t half_circle_bam = 0x80000000U;
+
+// Fixed-point angle, 32-bit binary angular measurement.  Resolution is
+// 360 / 2^32, about 8.4e-8 degrees — far below every sensor and display
+// in the pipeline.  Conversions to radians happen once, at the trig
+// boundary.
+class Angle
+{
+public:
+    constexpr Angle()
+        : raw_(0)
+    {
+    }
+
+    // Unsigned conversion wraps modulo 2^32: normalization comes free
+    static Angle from_degrees(double degrees)
+    {
+        return Angle(static_cast<uint32_t>(llround(degrees * deg_to_bam)));
+    }
+
+    static Angle from_radians(double radians)
+    {
+        return from_degrees(radians * rad_to_deg);
+    }
+
+    // [0, 360)
+    double degrees() const { return static_cast<double>(raw_) * bam_to_deg; }
+
+    // (-180, 180]: the exact half circle keeps the positive sign, matching
+    // the double normalization this replaces
+    double signed_degrees() const
+    {
+        return (raw_ == half_circle_bam)
+                   ? half_circle
+                   : static_cast<double>(static_cast<int32_t>(raw_)) * bam_to_deg;
+    }
+
+    double radians() const { return degrees() * deg_to_rad; }
+
+    double signed_radians() const { return signed_degrees() * deg_to_rad; }
+
+    Angle operator+(Angle other) const { return Angle(raw_ + other.raw_); }
+
+    Angle operator-(Angle other) const { return Angle(raw_ - other.raw_); }
+
+    uint32_t raw() const { return raw_; }
+
+private:
+    explicit constexpr Angle(uint32_t raw)
+        : raw_(raw)
+    {
+    }
+
+    uint32_t raw_;
+};
+
 }  // namespace units
 
 enum class Return_code : int32_t
@@ -33,32 +98,36 @@ enum class Return_code : int32_t
     simulated     = 4,  // Error was forced by the force_error parameter
 };
 
-namespace utils
+namespace calc
 {
 
-// Converts a string to a double
-bool parse_double(const char* str,  // Input string
-                  double& result)   // Converted double
-{
-    char* end = nullptr;
-    result    = strtod(str, &end);
-    return (end != str && *end == '\0');
-}
+// Sentinel for "effectively never" results, shared by the turn and VNAV calculators
+constexpr double infinite_time = 999.9;
 
-// Converts a string to an int
-bool parse_int32(const char* str,  // Input string
-                 int32_t& result)  // Converted int
+// Normalize angle to 0-360 range
+inline double normalize_angle(double angle)
 {
-    char* end  = nullptr;
-    long value = strtol(str, &end, 10);
-    if (end != str && *end == '\0')
+    double result = fmod(angle, units::angle_wrap);
+    if (result < 0.0)
     {
-        result = static_cast<int32_t>(value);
-        return true;
+        result += units::angle_wrap;
     }
-    return false;
+    return result;
 }
 
+}  // namespace calc
+
+namespace utils
+{
+
+// Converts a string to a double (defined in airv_utils.cpp, part of libairv.a)
+bool parse_double(const char* str,  // Input string
+                  double& result);  // Converted double
+
+// Converts a string to an int (defined in airv_utils.cpp, part of libairv.a)
+bool parse_int32(const char* str,   // Input string
+                 int32_t& result);  // Converted int
+
 }  // namespace utils
 
 }  // namespace airv
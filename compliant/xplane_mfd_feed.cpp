@@ -0,0 +1,350 @@
+// X-Plane push-feed daemon for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// One process for the whole fetch-compute-publish loop: subscribes to the
+// MFD's datarefs over the Web API WebSocket interface (xplane_ws_client.h),
+// runs the calculation cores on every pushed update, and publishes the
+// results into the shared-memory exchange segment (shm_exchange.h).  The
+// Python MFD then only reads published results — no REST polling, no
+// per-frame subprocesses, and the loop runs at simulator frame rate.
+//
+//   xplane_mfd_feed [--host=addr] [--port=n] [--shm=/segment_name]
+//                   [--manifest=path] [--no-manifest]
+//
+// The dataref name->id mapping persists in a binary manifest that is
+// memory-mapped on the next launch and revalidated with a single count
+// query, so a warm restart reaches the first computed frame without one
+// REST lookup per dataref.
+//
+// Each calculation core only reruns when an input it reads moved outside
+// its epsilon dead band (see dirty_tracker.h); otherwise the cached result
+// is republished.  In steady cruise almost every tick serves every core
+// from cache.
+
+#include "density_altitude_calc.h"
+#include "dirty_tracker.h"
+#include "flight_calc.h"
+#include "perf_timers.h"
+#include "shm_exchange.h"
+#include "turn_calc.h"
+#include "wind_calc.h"
+#include "xplane_mfd_calc.h"
+#include "xplane_ws_client.h"
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+namespace
+{
+
+// Subscription order; indices below must match
+const char* const feed_datarefs[] = {
+    "sim/flightmodel/position/true_airspeed",                 //  0: m/s
+    "sim/flightmodel/position/groundspeed",                   //  1: m/s
+    "sim/flightmodel/position/psi",                           //  2: deg
+    "sim/flightmodel/position/hpath",                         //  3: deg
+    "sim/cockpit2/gauges/indicators/airspeed_kts_pilot",      //  4: kts
+    "sim/flightmodel/misc/machno",                            //  5: Mach
+    "sim/flightmodel/position/elevation",                     //  6: m
+    "sim/flightmodel/position/y_agl",                         //  7: m
+    "sim/cockpit2/gauges/indicators/vvi_fpm_pilot",           //  8: fpm
+    "sim/flightmodel/weight/m_total",                         //  9: kg
+    "sim/flightmodel/position/phi",                           // 10: deg
+    "sim/aircraft/view/acf_Vso",                              // 11: kts
+    "sim/aircraft/view/acf_Vne",                              // 12: kts
+    "sim/aircraft/view/acf_Mmo",                              // 13: Mach
+    "sim/cockpit2/temperature/outside_air_temp_degc",         // 14: Celsius
+};
+
+constexpr int32_t feed_dataref_count = static_cast<int32_t>(sizeof(feed_datarefs) / sizeof(feed_datarefs[0]));
+
+constexpr double ms_to_kts = 1.0 / airv::units::kts_to_ms;
+
+// Tracked field indices 0..14 mirror the subscription order above; the
+// gust factor is tracked as its own field because the wind result depends
+// on it even when the raw IAS sits still
+constexpr int32_t field_gust   = feed_dataref_count;
+constexpr int32_t field_count  = feed_dataref_count + 1;
+
+// Epsilon dead band per tracked field, in the field's converted unit
+constexpr double field_epsilons[field_count] = {
+    0.05,    //  0: tas_kts
+    0.05,    //  1: gs_kts
+    0.05,    //  2: heading deg
+    0.05,    //  3: track deg
+    0.05,    //  4: ias_kts
+    0.0005,  //  5: mach
+    1.0,     //  6: altitude ft
+    1.0,     //  7: agl ft
+    5.0,     //  8: vs fpm
+    10.0,    //  9: weight kg
+    0.05,    // 10: bank deg
+    0.1,     // 11: vso kts
+    0.1,     // 12: vne kts
+    0.001,   // 13: mmo
+    0.1,     // 14: oat C
+    0.005,   // 15: gust factor
+};
+
+// Which tracked fields feed which calculator.  Glide reads the wind
+// headwind, so its mask includes every wind dependency.
+constexpr uint32_t wind_deps = airv::sched::field_bit(0) | airv::sched::field_bit(1) |
+                               airv::sched::field_bit(2) | airv::sched::field_bit(3) |
+                               airv::sched::field_bit(field_gust);
+constexpr uint32_t envelope_deps = airv::sched::field_bit(10) | airv::sched::field_bit(4) |
+                                   airv::sched::field_bit(5) | airv::sched::field_bit(11) |
+                                   airv::sched::field_bit(12) | airv::sched::field_bit(13);
+constexpr uint32_t energy_deps = airv::sched::field_bit(0) | airv::sched::field_bit(6) |
+                                 airv::sched::field_bit(8);
+constexpr uint32_t glide_deps = airv::sched::field_bit(7) | airv::sched::field_bit(0) | wind_deps;
+constexpr uint32_t turn_deps  = airv::sched::field_bit(0) | airv::sched::field_bit(10);
+constexpr uint32_t density_deps = airv::sched::field_bit(6) | airv::sched::field_bit(14) |
+                                  airv::sched::field_bit(4) | airv::sched::field_bit(0);
+
+// Last computed result per calculator, republished while its inputs rest
+struct CachedResults
+{
+    airv::calc::WindData wind;
+    airv::calc::EnvelopeMargins envelope;
+    airv::calc::EnergyData energy;
+    airv::calc::GlideData glide;
+    airv::calc::TurnData turn;
+    airv::calc::DensityAltitudeData da;
+};
+
+// Frame/compute counters for the shutdown skip-rate report
+struct FeedStats
+{
+    uint64_t frames   = 0;
+    uint64_t computes = 0;  // Calculator runs; 6 per frame without tracking
+};
+
+// Run only the calculators whose inputs moved, then publish
+void compute_and_publish(const airv::ws::XPlaneFeed& feed,
+                         airv::calc::SensorHistoryBuffer& ias_buffer,
+                         airv::sched::DirtyTracker& tracker,
+                         CachedResults& cached,
+                         FeedStats& stats,
+                         airv::perf::StageSet& perf,
+                         airv::shm::ExchangeFrame& frame,
+                         airv::shm::ExchangeWriter& shm_writer)
+{
+    airv::perf::ScopedTimer compute_timer(perf.stage(airv::perf::Stage::compute));
+
+    // Feed the raw update through the per-field dead bands
+    tracker.set_input(0, feed.value(0) * ms_to_kts);
+    tracker.set_input(1, feed.value(1) * ms_to_kts);
+    tracker.set_input(2, feed.value(2));
+    tracker.set_input(3, feed.value(3));
+    tracker.set_input(4, feed.value(4));
+    tracker.set_input(5, feed.value(5));
+    tracker.set_input(6, feed.value(6) * airv::units::m_to_ft);
+    tracker.set_input(7, feed.value(7) * airv::units::m_to_ft);
+    tracker.set_input(8, feed.value(8));
+    tracker.set_input(9, feed.value(9));
+    tracker.set_input(10, feed.value(10));
+    tracker.set_input(11, feed.value(11));
+    tracker.set_input(12, feed.value(12));
+    tracker.set_input(13, feed.value(13));
+    tracker.set_input(14, feed.value(14));
+
+    // The gust window always advances; its field only goes dirty when the
+    // resulting factor actually moved
+    ias_buffer.add_reading(feed.value(4));
+    tracker.set_input(field_gust, ias_buffer.gust_factor());
+
+    // Every calculator reads the accepted values, so consumers of a clean
+    // field see exactly what the cached result was computed from
+    double tas_kts = tracker.value(0);
+    double gs_kts  = tracker.value(1);
+    double heading = tracker.value(2);
+    double track   = tracker.value(3);
+    double ias_kts = tracker.value(4);
+    double mach    = tracker.value(5);
+    double alt_ft  = tracker.value(6);
+    double agl_ft  = tracker.value(7);
+    double vs_fpm  = tracker.value(8);
+    double weight  = tracker.value(9);
+    double bank    = tracker.value(10);
+    double vso_kts = tracker.value(11);
+    double vne_kts = tracker.value(12);
+    double mmo     = tracker.value(13);
+    double oat_c   = tracker.value(14);
+
+    if (tracker.is_dirty(wind_deps))
+    {
+        cached.wind =
+            airv::calc::calculate_wind_vector(tas_kts, gs_kts, heading, track, tracker.value(field_gust));
+        ++stats.computes;
+    }
+    if (tracker.is_dirty(envelope_deps))
+    {
+        cached.envelope = airv::calc::calculate_envelope(bank, ias_kts, mach, vso_kts, vne_kts, mmo);
+        ++stats.computes;
+    }
+    if (tracker.is_dirty(energy_deps))
+    {
+        cached.energy = airv::calc::calculate_energy(tas_kts, alt_ft, vs_fpm);
+        ++stats.computes;
+    }
+    if (tracker.is_dirty(glide_deps))
+    {
+        cached.glide = airv::calc::calculate_glide_reach(agl_ft, tas_kts, cached.wind.headwind);
+        ++stats.computes;
+    }
+    if (tracker.is_dirty(turn_deps))
+    {
+        cached.turn = airv::calc::calculate_turn_performance(tas_kts, bank, 0.0);
+        ++stats.computes;
+    }
+    if (tracker.is_dirty(density_deps))
+    {
+        cached.da = airv::calc::calculate_density_altitude_data(alt_ft, oat_c, ias_kts, tas_kts);
+        ++stats.computes;
+    }
+    tracker.mark_clean();
+    ++stats.frames;
+
+    frame.in.tas_kts         = tas_kts;
+    frame.in.gs_kts          = gs_kts;
+    frame.in.heading_deg     = heading;
+    frame.in.track_deg       = track;
+    frame.in.ias_kts         = ias_kts;
+    frame.in.mach            = mach;
+    frame.in.altitude_ft     = alt_ft;
+    frame.in.agl_ft          = agl_ft;
+    frame.in.vs_fpm          = vs_fpm;
+    frame.in.weight_kg       = weight;
+    frame.in.bank_deg        = bank;
+    frame.in.vso_kts         = vso_kts;
+    frame.in.vne_kts         = vne_kts;
+    frame.in.mmo             = mmo;
+    frame.in.pressure_alt_ft = alt_ft;  // Approximation until a baro dataref is fed
+    frame.in.oat_celsius     = oat_c;
+
+    airv::shm::store_wind_data(frame.out, cached.wind);
+    airv::shm::store_envelope(frame.out, cached.envelope);
+    airv::shm::store_energy(frame.out, cached.energy);
+    airv::shm::store_glide(frame.out, cached.glide);
+    airv::shm::store_turn(frame.out, cached.turn);
+    airv::shm::store_density_altitude(frame.out, cached.da);
+
+    {
+        airv::perf::ScopedTimer publish_timer(perf.stage(airv::perf::Stage::publish));
+        shm_writer.publish(frame);
+    }
+}
+
+}  // namespace
+
+int main(int argc,
+         char* argv[])
+{
+    const char* host     = airv::ws::default_host;
+    const char* shm_name = airv::shm::default_segment_name;
+    const char* manifest = airv::ws::default_manifest_path;
+    uint16_t port        = airv::ws::default_port;
+
+    for (int32_t i = 1; i < argc; ++i)
+    {
+        if (strncmp(argv[i], "--host=", 7) == 0)
+        {
+            host = &argv[i][7];
+        }
+        else if (strncmp(argv[i], "--port=", 7) == 0)
+        {
+            port = static_cast<uint16_t>(strtoul(&argv[i][7], nullptr, 10));
+        }
+        else if (strncmp(argv[i], "--shm=", 6) == 0)
+        {
+            shm_name = &argv[i][6];
+        }
+        else if (strncmp(argv[i], "--manifest=", 11) == 0)
+        {
+            manifest = &argv[i][11];
+        }
+        else if (strcmp(argv[i], "--no-manifest") == 0)
+        {
+            manifest = nullptr;
+        }
+        else
+        {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--host=addr] [--port=n] [--shm=/segment_name] [--manifest=path] [--no-manifest]\n";
+            return static_cast<int>(airv::Return_code::invalid_argc);
+        }
+    }
+
+    airv::ws::XPlaneFeed feed;
+    feed.set_manifest(manifest);
+    for (int32_t i = 0; i < feed_dataref_count; ++i)
+    {
+        if (!feed.add_dataref(feed_datarefs[i]))
+        {
+            std::cerr << "Error: Too many datarefs\n";
+            return static_cast<int>(airv::Return_code::invalid_value);
+        }
+    }
+
+    airv::shm::ExchangeFrame frame;
+    airv::shm::ExchangeWriter shm_writer;
+
+    memset(&frame, 0, sizeof(frame));
+    if (!shm_writer.open(shm_name))
+    {
+        std::cerr << "Error: Cannot open shared-memory segment " << shm_name << "\n";
+        return static_cast<int>(airv::Return_code::invalid_value);
+    }
+
+    if (!feed.connect(host, port))
+    {
+        std::cerr << "Error: Cannot connect to the X-Plane Web API at " << host << ":" << port << "\n";
+        return static_cast<int>(airv::Return_code::invalid_value);
+    }
+    std::cerr << "Subscribed to " << feed.count() << " datarefs; publishing to " << shm_name << "\n";
+
+    airv::calc::SensorHistoryBuffer ias_buffer;
+    airv::sched::DirtyTracker tracker;
+    CachedResults cached;
+    FeedStats stats;
+    airv::perf::StageSet perf;
+
+    memset(&cached, 0, sizeof(cached));
+    for (int32_t i = 0; i < field_count; ++i)
+    {
+        tracker.add_field(field_epsilons[i]);
+    }
+
+    bool connected = true;
+
+    while (connected)
+    {
+        {
+            airv::perf::ScopedTimer timer(perf.stage(airv::perf::Stage::receive));
+            connected = feed.poll();
+        }
+        if (connected && feed.complete())
+        {
+            compute_and_publish(feed, ias_buffer, tracker, cached, stats, perf, frame, shm_writer);
+        }
+    }
+
+    std::cerr << "Connection to X-Plane lost\n";
+    if (stats.frames > 0)
+    {
+        std::cerr << "Frames: " << stats.frames << ", calculator runs: " << stats.computes << " of "
+                  << (stats.frames * 6U) << "\n";
+
+        static char buffer[airv::json::default_buffer_size];
+        airv::json::Writer writer(buffer, sizeof(buffer));
+
+        writer.open_object();
+        airv::perf::append_perf_json(writer, perf);
+        writer.close_object();
+        fwrite(writer.data(), 1, writer.length(), stderr);
+    }
+    feed.close();
+
+    return static_cast<int>(airv::Return_code::success);
+}
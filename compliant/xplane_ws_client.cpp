@@ -0,0 +1,726 @@
+// Native X-Plane Web API client for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// Wire details: the id lookup is one HTTP/1.1 GET per dataref at startup
+// (Connection: close, so no keep-alive parsing).  The WebSocket handshake
+// sends a random Sec-WebSocket-Key; the server's Accept hash is not
+// re-verified — we only talk to the local simulator, and a broken peer
+// fails the very next frame parse anyway.  Updates arrive as
+// dataref_update_values messages whose "data" object maps id strings to
+// numbers; the scanner below extracts exactly that shape without a general
+// JSON parser.
+
+#include "xplane_ws_client.h"
+
+#include <arpa/inet.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace airv
+{
+namespace ws
+{
+
+namespace
+{
+
+// WebSocket opcodes (RFC 6455 section 5.2)
+constexpr uint8_t opcode_text  = 0x1;
+constexpr uint8_t opcode_close = 0x8;
+constexpr uint8_t opcode_ping  = 0x9;
+constexpr uint8_t opcode_pong  = 0xA;
+
+constexpr uint8_t flag_fin  = 0x80;
+constexpr uint8_t flag_mask = 0x80;
+
+const char base64_table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// Encode length bytes into out (NUL-terminated); out must hold 4*((n+2)/3)+1
+void base64_encode(const uint8_t* data,
+                   size_t length,
+                   char* out)
+{
+    size_t o = 0;
+
+    for (size_t i = 0; i < length; i += 3)
+    {
+        uint32_t chunk = static_cast<uint32_t>(data[i]) << 16;
+        if (i + 1 < length)
+        {
+            chunk |= static_cast<uint32_t>(data[i + 1]) << 8;
+        }
+        if (i + 2 < length)
+        {
+            chunk |= static_cast<uint32_t>(data[i + 2]);
+        }
+
+        out[o++] = base64_table[(chunk >> 18) & 0x3F];
+        out[o++] = base64_table[(chunk >> 12) & 0x3F];
+        out[o++] = (i + 1 < length) ? base64_table[(chunk >> 6) & 0x3F] : '=';
+        out[o++] = (i + 2 < length) ? base64_table[chunk & 0x3F] : '=';
+    }
+
+    out[o] = '\0';
+}
+
+// Open one TCP connection to host:port; returns the fd or -1
+int tcp_connect(const char* host,
+                uint16_t port)
+{
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+
+    if (fd >= 0)
+    {
+        struct sockaddr_in addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_port   = htons(port);
+
+        bool ok = (inet_pton(AF_INET, host, &addr.sin_addr) == 1) &&
+                  (::connect(fd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) == 0);
+        if (ok)
+        {
+            // Updates are small and latency-sensitive
+            int one = 1;
+            setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        }
+        else
+        {
+            ::close(fd);
+            fd = -1;
+        }
+    }
+
+    return fd;
+}
+
+// Find "key": after position start; returns pointer past the colon or nullptr
+const char* find_value(const char* doc,
+                       const char* key)
+{
+    char pattern[64];
+    snprintf(pattern, sizeof(pattern), "\"%s\"", key);
+
+    const char* at     = strstr(doc, pattern);
+    const char* result = nullptr;
+
+    if (at != nullptr)
+    {
+        at = strchr(at + strlen(pattern), ':');
+        if (at != nullptr)
+        {
+            ++at;
+            while (*at == ' ' || *at == '\t' || *at == '\n' || *at == '\r')
+            {
+                ++at;
+            }
+            result = at;
+        }
+    }
+
+    return result;
+}
+
+// One short-lived HTTP/1.1 GET; fills response (NUL-terminated) until EOF
+bool http_get(const char* host,
+              uint16_t port,
+              const char* request_path,
+              char* response,
+              size_t capacity)
+{
+    int fd  = tcp_connect(host, port);
+    bool ok = (fd >= 0);
+
+    if (ok)
+    {
+        char request[max_request_length];
+        int n = snprintf(request,
+                         sizeof(request),
+                         "GET %s HTTP/1.1\r\n"
+                         "Host: %s:%u\r\n"
+                         "Connection: close\r\n"
+                         "\r\n",
+                         request_path,
+                         host,
+                         static_cast<unsigned>(port));
+        ok = (n > 0) && (write(fd, request, static_cast<size_t>(n)) == n);
+    }
+
+    if (ok)
+    {
+        size_t got = 0;
+
+        for (;;)
+        {
+            ssize_t n = read(fd, &response[got], capacity - 1 - got);
+            if (n <= 0)
+            {
+                break;
+            }
+            got += static_cast<size_t>(n);
+        }
+        response[got] = '\0';
+        ok            = (got > 0);
+    }
+
+    if (fd >= 0)
+    {
+        ::close(fd);
+    }
+
+    return ok;
+}
+
+}  // namespace
+
+WebSocketClient::WebSocketClient()
+    : fd_(-1),
+      mask_seed_(static_cast<uint32_t>(time(nullptr)) ^ 0x5DEECE66U)
+{
+}
+
+bool WebSocketClient::connect(const char* host,
+                              uint16_t port,
+                              const char* path)
+{
+    fd_ = tcp_connect(host, port);
+
+    bool ok = (fd_ >= 0);
+
+    if (ok)
+    {
+        // Random-enough key; the server echoes its hash, which we don't check
+        uint8_t key_bytes[16];
+        char key[32];
+        for (int32_t i = 0; i < 16; ++i)
+        {
+            mask_seed_   = (mask_seed_ * 1103515245U) + 12345U;
+            key_bytes[i] = static_cast<uint8_t>(mask_seed_ >> 16);
+        }
+        base64_encode(key_bytes, sizeof(key_bytes), key);
+
+        char request[max_request_length];
+        int n = snprintf(request,
+                         sizeof(request),
+                         "GET %s HTTP/1.1\r\n"
+                         "Host: %s:%u\r\n"
+                         "Upgrade: websocket\r\n"
+                         "Connection: Upgrade\r\n"
+                         "Sec-WebSocket-Key: %s\r\n"
+                         "Sec-WebSocket-Version: 13\r\n"
+                         "\r\n",
+                         path,
+                         host,
+                         static_cast<unsigned>(port),
+                         key);
+        ok = (n > 0) && write_all(reinterpret_cast<const uint8_t*>(request), static_cast<size_t>(n));
+    }
+
+    if (ok)
+    {
+        // Read the upgrade response up to the header terminator
+        char response[max_request_length];
+        size_t got = 0;
+        bool done  = false;
+
+        while (ok && !done && got < sizeof(response) - 1)
+        {
+            ssize_t n = read(fd_, &response[got], 1);
+            ok        = (n == 1);
+            if (ok)
+            {
+                ++got;
+                response[got] = '\0';
+                done          = (got >= 4) && (strcmp(&response[got - 4], "\r\n\r\n") == 0);
+            }
+        }
+
+        ok = ok && done && (strstr(response, " 101 ") != nullptr);
+    }
+
+    if (!ok && fd_ >= 0)
+    {
+        ::close(fd_);
+        fd_ = -1;
+    }
+
+    return ok;
+}
+
+bool WebSocketClient::send_text(const char* payload,
+                                size_t length)
+{
+    // Header worst case: 2 + 8 (extended length) + 4 (mask)
+    uint8_t header[14];
+    size_t header_length = 0;
+
+    header[0] = flag_fin | opcode_text;
+    if (length < 126)
+    {
+        header[1]     = flag_mask | static_cast<uint8_t>(length);
+        header_length = 2;
+    }
+    else
+    {
+        header[1]     = flag_mask | 126;
+        header[2]     = static_cast<uint8_t>(length >> 8);
+        header[3]     = static_cast<uint8_t>(length & 0xFF);
+        header_length = 4;
+    }
+
+    uint8_t mask[4];
+    for (int32_t i = 0; i < 4; ++i)
+    {
+        mask_seed_ = (mask_seed_ * 1103515245U) + 12345U;
+        mask[i]    = static_cast<uint8_t>(mask_seed_ >> 16);
+        header[header_length] = mask[i];
+        ++header_length;
+    }
+
+    bool ok = (length <= max_message_length) && write_all(header, header_length);
+
+    if (ok)
+    {
+        uint8_t masked[max_message_length];
+        for (size_t i = 0; i < length; ++i)
+        {
+            masked[i] = static_cast<uint8_t>(payload[i]) ^ mask[i & 3];
+        }
+        ok = write_all(masked, length);
+    }
+
+    return ok;
+}
+
+int64_t WebSocketClient::receive_text(char* buffer,
+                                      size_t capacity)
+{
+    int64_t result = -1;
+    bool done      = false;
+
+    while (!done && fd_ >= 0)
+    {
+        uint8_t header[2];
+        if (!read_exact(header, 2))
+        {
+            break;
+        }
+
+        uint8_t opcode        = header[0] & 0x0F;
+        bool masked           = (header[1] & flag_mask) != 0;
+        uint64_t length       = header[1] & 0x7F;
+
+        if (length == 126)
+        {
+            uint8_t ext[2];
+            if (!read_exact(ext, 2))
+            {
+                break;
+            }
+            length = (static_cast<uint64_t>(ext[0]) << 8) | ext[1];
+        }
+        else if (length == 127)
+        {
+            uint8_t ext[8];
+            if (!read_exact(ext, 8))
+            {
+                break;
+            }
+            length = 0;
+            for (int32_t i = 0; i < 8; ++i)
+            {
+                length = (length << 8) | ext[i];
+            }
+        }
+
+        uint8_t mask[4] = {0, 0, 0, 0};
+        if (masked && !read_exact(mask, 4))
+        {
+            break;
+        }
+
+        if (length >= capacity || length > max_message_length)
+        {
+            // Oversized frame: the stream is beyond recovery
+            close();
+            break;
+        }
+
+        uint8_t payload[max_message_length];
+        if (length > 0 && !read_exact(payload, static_cast<size_t>(length)))
+        {
+            break;
+        }
+        if (masked)
+        {
+            for (uint64_t i = 0; i < length; ++i)
+            {
+                payload[i] ^= mask[i & 3];
+            }
+        }
+
+        if (opcode == opcode_text)
+        {
+            memcpy(buffer, payload, static_cast<size_t>(length));
+            buffer[length] = '\0';
+            result         = static_cast<int64_t>(length);
+            done           = true;
+        }
+        else if (opcode == opcode_ping)
+        {
+            // Echo the payload back as a masked pong
+            uint8_t pong[14];
+            size_t n  = 0;
+            pong[n++] = flag_fin | opcode_pong;
+            pong[n++] = flag_mask | static_cast<uint8_t>(length);
+            uint8_t pong_mask[4];
+            for (int32_t i = 0; i < 4; ++i)
+            {
+                mask_seed_   = (mask_seed_ * 1103515245U) + 12345U;
+                pong_mask[i] = static_cast<uint8_t>(mask_seed_ >> 16);
+                pong[n++]    = pong_mask[i];
+            }
+            bool ok = write_all(pong, n);
+            for (uint64_t i = 0; ok && i < length; ++i)
+            {
+                payload[i] ^= pong_mask[i & 3];
+            }
+            if (ok && length > 0)
+            {
+                write_all(payload, static_cast<size_t>(length));
+            }
+        }
+        else if (opcode == opcode_close)
+        {
+            close();
+        }
+        else
+        {
+            // Pong or continuation of a control exchange: ignore
+        }
+    }
+
+    return result;
+}
+
+void WebSocketClient::close()
+{
+    if (fd_ >= 0)
+    {
+        ::close(fd_);
+        fd_ = -1;
+    }
+}
+
+bool WebSocketClient::read_exact(uint8_t* buffer,
+                                 size_t length)
+{
+    size_t got = 0;
+
+    while (got < length)
+    {
+        ssize_t n = read(fd_, &buffer[got], length - got);
+        if (n <= 0)
+        {
+            close();
+            break;
+        }
+        got += static_cast<size_t>(n);
+    }
+
+    return got == length;
+}
+
+bool WebSocketClient::write_all(const uint8_t* buffer,
+                                size_t length)
+{
+    size_t sent = 0;
+
+    while (sent < length)
+    {
+        ssize_t n = write(fd_, &buffer[sent], length - sent);
+        if (n <= 0)
+        {
+            close();
+            break;
+        }
+        sent += static_cast<size_t>(n);
+    }
+
+    return sent == length;
+}
+
+XPlaneFeed::XPlaneFeed()
+    : count_(0),
+      manifest_path_(nullptr)
+{
+}
+
+bool XPlaneFeed::add_dataref(const char* name)
+{
+    bool ok = (count_ < max_datarefs) && (strlen(name) < max_dataref_name);
+
+    if (ok)
+    {
+        Dataref& slot = datarefs_[count_];
+        strncpy(slot.name, name, max_dataref_name - 1);
+        slot.name[max_dataref_name - 1] = '\0';
+        slot.id       = -1;
+        slot.value    = 0.0;
+        slot.received = false;
+        ++count_;
+    }
+
+    return ok;
+}
+
+bool XPlaneFeed::connect(const char* host,
+                         uint16_t port)
+{
+    bool ok             = (count_ > 0);
+    bool from_manifest  = false;
+    int64_t sim_count   = -1;
+
+    // Warm path: one count query revalidates the whole persisted mapping
+    if (ok && manifest_path_ != nullptr && fetch_dataref_count(host, port, sim_count))
+    {
+        from_manifest = load_manifest(sim_count);
+    }
+
+    for (int32_t i = 0; ok && !from_manifest && i < count_; ++i)
+    {
+        ok = resolve_id(host, port, datarefs_[i]);
+    }
+
+    if (ok && !from_manifest && manifest_path_ != nullptr && sim_count >= 0)
+    {
+        save_manifest(sim_count);
+    }
+
+    ok = ok && socket_.connect(host, port, api_path);
+    ok = ok && subscribe();
+
+    return ok;
+}
+
+bool XPlaneFeed::poll()
+{
+    char message[max_message_length];
+    int64_t length = socket_.receive_text(message, sizeof(message));
+    bool ok        = (length > 0);
+
+    if (ok)
+    {
+        const char* type = find_value(message, "type");
+        if (type != nullptr && strncmp(type, "\"dataref_update_values\"", 23) == 0)
+        {
+            const char* data = find_value(message, "data");
+            for (int32_t i = 0; data != nullptr && i < count_; ++i)
+            {
+                // Update keys are the numeric ids as strings
+                char key[24];
+                snprintf(key, sizeof(key), "%lld", static_cast<long long>(datarefs_[i].id));
+                const char* at = find_value(data, key);
+                if (at != nullptr)
+                {
+                    datarefs_[i].value    = strtod(at, nullptr);
+                    datarefs_[i].received = true;
+                }
+            }
+        }
+    }
+
+    return ok;
+}
+
+bool XPlaneFeed::complete() const
+{
+    bool all = (count_ > 0);
+
+    for (int32_t i = 0; all && i < count_; ++i)
+    {
+        all = datarefs_[i].received;
+    }
+
+    return all;
+}
+
+bool XPlaneFeed::resolve_id(const char* host,
+                            uint16_t port,
+                            Dataref& dataref)
+{
+    static char response[max_message_length];
+    char request_path[max_request_length];
+
+    snprintf(request_path, sizeof(request_path), "%s/datarefs?filter[name]=%s", api_path, dataref.name);
+
+    bool ok = http_get(host, port, request_path, response, sizeof(response));
+
+    if (ok)
+    {
+        const char* at = find_value(response, "id");
+        ok             = (at != nullptr);
+        if (ok)
+        {
+            dataref.id = strtoll(at, nullptr, 10);
+            ok         = (dataref.id >= 0);
+        }
+    }
+
+    return ok;
+}
+
+bool XPlaneFeed::fetch_dataref_count(const char* host,
+                                     uint16_t port,
+                                     int64_t& count)
+{
+    static char response[max_message_length];
+    char request_path[max_request_length];
+
+    snprintf(request_path, sizeof(request_path), "%s/datarefs/count", api_path);
+
+    bool ok = http_get(host, port, request_path, response, sizeof(response));
+
+    if (ok)
+    {
+        const char* at = find_value(response, "data");
+        ok             = (at != nullptr);
+        if (ok)
+        {
+            count = strtoll(at, nullptr, 10);
+            ok    = (count > 0);
+        }
+    }
+
+    return ok;
+}
+
+bool XPlaneFeed::load_manifest(int64_t sim_dataref_count)
+{
+    int fd  = open(manifest_path_, O_RDONLY);
+    bool ok = (fd >= 0);
+
+    struct stat info;
+    void* mapped  = nullptr;
+    size_t length = 0;
+
+    if (ok)
+    {
+        ok = (fstat(fd, &info) == 0) && (static_cast<size_t>(info.st_size) >= sizeof(ManifestHeader));
+    }
+    if (ok)
+    {
+        length = static_cast<size_t>(info.st_size);
+        mapped = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        ok     = (mapped != MAP_FAILED);
+    }
+
+    if (ok)
+    {
+        const ManifestHeader* header = static_cast<const ManifestHeader*>(mapped);
+
+        ok = (header->magic == manifest_magic) && (header->version == manifest_version) &&
+             (header->sim_dataref_count == sim_dataref_count) &&
+             (length >= sizeof(ManifestHeader) + (header->entry_count * sizeof(ManifestEntry)));
+
+        if (ok)
+        {
+            const ManifestEntry* entries =
+                reinterpret_cast<const ManifestEntry*>(static_cast<const char*>(mapped) + sizeof(ManifestHeader));
+
+            // Every registered name must be present; order may differ
+            for (int32_t i = 0; ok && i < count_; ++i)
+            {
+                bool found = false;
+                for (uint32_t e = 0; !found && e < header->entry_count; ++e)
+                {
+                    if (strncmp(entries[e].name, datarefs_[i].name, max_dataref_name) == 0)
+                    {
+                        datarefs_[i].id = entries[e].id;
+                        found           = true;
+                    }
+                }
+                ok = found;
+            }
+        }
+    }
+
+    if (mapped != nullptr && mapped != MAP_FAILED)
+    {
+        munmap(mapped, length);
+    }
+    if (fd >= 0)
+    {
+        ::close(fd);
+    }
+
+    return ok;
+}
+
+void XPlaneFeed::save_manifest(int64_t sim_dataref_count) const
+{
+    FILE* out = fopen(manifest_path_, "wb");
+
+    if (out != nullptr)
+    {
+        ManifestHeader header;
+        memset(&header, 0, sizeof(header));
+        header.magic             = manifest_magic;
+        header.version           = manifest_version;
+        header.entry_count       = static_cast<uint32_t>(count_);
+        header.sim_dataref_count = sim_dataref_count;
+
+        bool ok = (fwrite(&header, sizeof(header), 1, out) == 1);
+        for (int32_t i = 0; ok && i < count_; ++i)
+        {
+            ManifestEntry entry;
+            memset(&entry, 0, sizeof(entry));
+            strncpy(entry.name, datarefs_[i].name, max_dataref_name - 1);
+            entry.id = datarefs_[i].id;
+            ok       = (fwrite(&entry, sizeof(entry), 1, out) == 1);
+        }
+        fclose(out);
+
+        if (!ok)
+        {
+            remove(manifest_path_);  // Never leave a torn manifest behind
+        }
+    }
+}
+
+bool XPlaneFeed::subscribe()
+{
+    char request[max_request_length];
+    size_t length = 0;
+    bool ok       = true;
+
+    length += static_cast<size_t>(snprintf(&request[length],
+                                           sizeof(request) - length,
+                                           "{\"req_id\": 1, \"type\": \"dataref_subscribe_values\", "
+                                           "\"params\": {\"datarefs\": ["));
+    for (int32_t i = 0; ok && i < count_; ++i)
+    {
+        int n = snprintf(&request[length],
+                         sizeof(request) - length,
+                         "%s{\"id\": %lld}",
+                         (i > 0) ? ", " : "",
+                         static_cast<long long>(datarefs_[i].id));
+        ok = (n > 0) && (length + static_cast<size_t>(n) < sizeof(request));
+        length += static_cast<size_t>(n);
+    }
+    length += static_cast<size_t>(snprintf(&request[length], sizeof(request) - length, "]}}"));
+
+    return ok && socket_.send_text(request, length);
+}
+
+}  // namespace ws
+}  // namespace airv
@@ -0,0 +1,161 @@
+// Native X-Plane Web API client for X-Plane MFD
+// JSF AV C++ Coding Standard Compliant Version
+//
+// Replaces the per-frame Python REST polling with one long-lived connection:
+// dataref ids are resolved once over plain HTTP, then the Web API's
+// WebSocket subscription interface pushes value updates at simulator frame
+// rate.  The WebSocket layer is a minimal RFC 6455 client (text frames,
+// client-side masking, ping/pong) over POSIX sockets with fixed buffers —
+// no external dependency and no heap traffic on the receive path.
+
+#ifndef XPLANE_WS_CLIENT
+#define XPLANE_WS_CLIENT
+
+#include <cstddef>
+#include <cstdint>
+
+namespace airv
+{
+namespace ws
+{
+
+// Web API defaults (X-Plane 12.1+)
+constexpr uint16_t default_port    = 8086;
+constexpr const char* default_host = "127.0.0.1";
+constexpr const char* api_path     = "/api/v1";
+
+// Fixed I/O limits
+constexpr size_t max_message_length = 16384;  // Largest update frame we accept
+constexpr size_t max_request_length = 2048;   // Handshake / subscribe requests
+constexpr int32_t max_datarefs      = 32;     // Subscriptions per connection
+constexpr size_t max_dataref_name   = 128;
+
+// Binary dataref manifest: name->id mapping persisted across runs so a warm
+// restart skips the per-name REST lookups entirely
+constexpr uint32_t manifest_magic        = 0x4D46444DU;  // "MFDM"
+constexpr uint32_t manifest_version      = 1U;
+constexpr const char* default_manifest_path = ".dataref_manifest.bin";
+
+struct ManifestHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t entry_count;
+    uint32_t reserved;
+    int64_t sim_dataref_count;  // Sim's total dataref count when written
+};
+
+struct ManifestEntry
+{
+    char name[max_dataref_name];
+    int64_t id;
+};
+
+// Minimal RFC 6455 client over one blocking TCP connection
+class WebSocketClient
+{
+public:
+    WebSocketClient();
+
+    // TCP connect and HTTP upgrade; returns false on any failure
+    bool connect(const char* host,
+                 uint16_t port,
+                 const char* path);
+
+    // Send one masked text frame
+    bool send_text(const char* payload,
+                   size_t length);
+
+    // Receive the next text message into the caller's buffer (NUL-terminated).
+    // Control frames are handled internally; returns the payload length or -1
+    // when the connection is gone.
+    int64_t receive_text(char* buffer,
+                         size_t capacity);
+
+    void close();
+
+    bool is_connected() const { return fd_ >= 0; }
+
+private:
+    bool read_exact(uint8_t* buffer,
+                    size_t length);
+
+    bool write_all(const uint8_t* buffer,
+                   size_t length);
+
+    int fd_;
+    uint32_t mask_seed_;  // Per-frame masking keys derive from this
+};
+
+// One subscribed dataref and its latest pushed value
+struct Dataref
+{
+    char name[max_dataref_name];
+    int64_t id;     // Web API numeric id, resolved once
+    double value;   // Latest pushed value
+    bool received;  // True once at least one update arrived
+};
+
+// Subscription session over the Web API
+class XPlaneFeed
+{
+public:
+    XPlaneFeed();
+
+    // Register a dataref before connect(); returns false when full
+    bool add_dataref(const char* name);
+
+    // Use a persisted manifest for id resolution (nullptr disables).  A valid
+    // manifest replaces the per-name REST lookups with one mmap plus a single
+    // count revalidation; a stale or missing one is rewritten after resolving.
+    void set_manifest(const char* path) { manifest_path_ = path; }
+
+    // Resolve every id (manifest or HTTP), open the WebSocket and subscribe
+    bool connect(const char* host,
+                 uint16_t port);
+
+    // Block for the next update message and fold it into the dataref values.
+    // Returns false when the connection dropped.
+    bool poll();
+
+    void close() { socket_.close(); }
+
+    int32_t count() const { return count_; }
+
+    const Dataref& at(int32_t index) const { return datarefs_[index]; }
+
+    // Latest value by registration order; 0.0 until the first update
+    double value(int32_t index) const { return datarefs_[index].value; }
+
+    // True once every subscribed dataref has reported at least once
+    bool complete() const;
+
+private:
+    // GET /api/v1/datarefs?filter[name]=... and extract the numeric id
+    bool resolve_id(const char* host,
+                    uint16_t port,
+                    Dataref& dataref);
+
+    // GET /api/v1/datarefs/count — the manifest's cheap revalidation token
+    bool fetch_dataref_count(const char* host,
+                             uint16_t port,
+                             int64_t& count);
+
+    // Memory-map the manifest and fill every id from it; false if the file
+    // is missing, stale, or lacks any registered name
+    bool load_manifest(int64_t sim_dataref_count);
+
+    void save_manifest(int64_t sim_dataref_count) const;
+
+    bool subscribe();
+
+    WebSocketClient socket_;
+    Dataref datarefs_[max_datarefs];
+    int32_t count_;
+    const char* manifest_path_;
+};
+
+}  // namespace ws
+}  // namespace airv
+
+#endif  // !XPLANE_WS_CLIENT